@@ -0,0 +1,91 @@
+/**
+ * @file binding.hpp
+ * @author Mohammed Ghaith Al-Mahdawi (Mohido)
+ * @brief Benchmarks binding a document to structs against loading the tree and converting the fields by hand.
+ */
+
+#include <iostream>
+#include <fstream>
+#include <filesystem>
+#include <string>
+#include <vector>
+#include <chrono>
+#include "corpus.hpp"
+#include "../yaml/yaml.hpp"
+
+namespace TINY_YAML{
+namespace benchmarks {
+
+    struct BenchItem {
+        std::string item1;
+    };
+    TINY_YAML_BIND(BenchItem, TINY_YAML_FIELD(item1))
+
+    struct BenchRecord {
+        std::string name;
+        long value = 0;
+        std::vector<BenchItem> hell;
+        std::vector<std::string> extra;
+    };
+    TINY_YAML_BIND(BenchRecord, TINY_YAML_FIELD(name), TINY_YAML_FIELD(value), TINY_YAML_FIELD(hell), TINY_YAML_FIELD(extra))
+
+    struct BenchRecords {
+        std::vector<BenchRecord> records;
+    };
+    TINY_YAML_BIND(BenchRecords, TINY_YAML_FIELD_NAMED("node_list", records))
+
+    #ifndef TINY_YAML_BENCHMARKS_HELPER_FUNCS
+    #define TINY_YAML_BENCHMARKS_HELPER_FUNCS
+        /// @brief - Runs the function `repeat` times and returns the best run in seconds.
+        template<typename F>
+        double bestOf(int repeat, F function){
+            double best = 1e30;
+            for (int i = 0; i < repeat; i++) {
+                auto start = std::chrono::steady_clock::now();
+                function();
+                double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                best = (elapsed < best) ? elapsed : best;
+            }
+            return best;
+        }
+
+        /// @brief - Prints the throughput of a benchmark.
+        void report(const std::string& name, std::size_t bytes, double seconds){
+            std::cout << "BENCH: " << name << ": " << (bytes / seconds) / (1024.0 * 1024.0) << " MB/s" << std::endl;
+        }
+    #endif
+
+    void bench_binding(){
+        std::cout << "############# BENCHGROUP: bench_binding" << std::endl;
+        std::string text = corpus::recordList(100000);
+        std::filesystem::path path = corpus::write("binding", text);
+
+        std::size_t checksum = 0;
+        double bound = bestOf(3, [&]() {
+            BenchRecords records;
+            std::string error;
+            TINY_YAML::bindFile(path.string(), records, error);
+            checksum += records.records.size();
+        });
+        report("bindFile into structs", text.size(), bound);
+
+        double walked = bestOf(3, [&]() {
+            Yaml yaml(path.string());
+            BenchRecords records;
+            for (Node& node : yaml["node_list"]) {
+                BenchRecord& record = records.records.emplace_back();
+                record.name = std::string(node["name"].getValue().substr(1, node["name"].getValue().size() - 2));
+                record.value = node["value"].as<long>();
+                for (Node& item : node["hell"])
+                    record.hell.push_back({ std::string(item["item1"].getValue()) });
+                for (Node& item : node["extra"])
+                    record.extra.emplace_back(item.getValue());
+            }
+            checksum += records.records.size();
+        });
+        report("load + convert by hand", text.size(), walked);
+        std::cout << "-- BENCHGROUP bench_binding checksum: " << checksum << std::endl;
+        std::filesystem::remove(path);
+        std::cout << "############################" << std::endl;
+    }
+}}
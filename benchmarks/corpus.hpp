@@ -0,0 +1,100 @@
+/**
+ * @file corpus.hpp
+ * @author Mohammed Ghaith Al-Mahdawi (Mohido)
+ * @brief Generates large synthetic yaml documents of the shapes the parser meets: deep nesting, wide mappings,
+ *        long scalar lists and lists of mappings like tests/5.yaml. The output is deterministic for a given size.
+ */
+
+#ifndef TINY_YAML_BENCHMARKS_CORPUS
+#define TINY_YAML_BENCHMARKS_CORPUS
+
+#include <fstream>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace TINY_YAML{
+namespace benchmarks {
+namespace corpus {
+
+    /// @brief - `chains` root keys, each opening a chain of `depth` nested mappings ending with a scalar.
+    std::string deepNesting(int chains, int depth){
+        std::string text;
+        for (int c = 0; c < chains; c++) {
+            text += "chain_" + std::to_string(c) + ":\n";
+            for (int d = 1; d < depth; d++)
+                text += std::string(2 * d, ' ') + "level_" + std::to_string(d) + ":\n";
+            text += std::string(2 * depth, ' ') + "leaf: " + std::to_string(c) + "\n";
+        }
+        return text;
+    }
+
+    /// @brief - One mapping with `width` keys, the path of every key is `map.<key>`.
+    std::string wideMapping(int width, std::vector<std::string>* keys = nullptr){
+        std::string text = "map:\n";
+        for (int i = 0; i < width; i++) {
+            std::string key = "field_" + std::to_string(i * 7919 % 1000003);
+            text += "  " + key + ": value " + std::to_string(i) + "\n";
+            if (keys != nullptr)
+                keys->push_back(key);
+        }
+        return text;
+    }
+
+    /// @brief - One sequence of `items` scalars of mixed types.
+    std::string scalarList(int items){
+        std::string text = "list:\n";
+        for (int i = 0; i < items; i++) {
+            switch (i % 4) {
+            case 0: text += "  - " + std::to_string(i) + "\n"; break;
+            case 1: text += "  - " + std::to_string(i) + ".5\n"; break;
+            case 2: text += "  - \"quoted " + std::to_string(i) + "\"\n"; break;
+            default: text += "  - plain text " + std::to_string(i) + "\n"; break;
+            }
+        }
+        return text;
+    }
+
+    /// @brief - `rows` keys holding `columns` integers each, as flow sequences (`[1, 2, 3]`) or as block lists.
+    std::string numberRows(int rows, int columns, bool flow){
+        std::string text;
+        for (int i = 0; i < rows; i++) {
+            text += "row" + std::to_string(i) + (flow ? ": [" : ":\n");
+            for (int j = 0; j < columns; j++) {
+                std::string number = std::to_string(i * columns + j);
+                text += flow ? ((j == 0) ? number : ", " + number) : "  - " + number + "\n";
+            }
+            if (flow)
+                text += "]\n";
+        }
+        return text;
+    }
+
+    /// @brief - A sequence of `records` mappings shaped like tests/5.yaml (scalars, a nested list of mappings, a scalar list).
+    std::string recordList(int records){
+        std::string text = "node_list:\n";
+        for (int i = 0; i < records; i++) {
+            std::string id = std::to_string(i);
+            text += "  - name: \"node" + id + "\"\n"
+                    "    value: " + id + "\n"
+                    "    hell:\n"
+                    "      - item1: \"sang\"\n"
+                    "      - item1: \"mang\"\n"
+                    "    extra:\n"
+                    "      - extra1\n"
+                    "      - extra2\n";
+        }
+        return text;
+    }
+
+    /// @brief - Writes a generated document to the temporary directory.
+    /// @return - Path of the file, remove it when done.
+    std::filesystem::path write(const std::string& name, const std::string& text){
+        std::filesystem::path path = std::filesystem::temp_directory_path() / ("tiny_yaml_corpus_" + name + ".yaml");
+        std::ofstream file(path, std::ios::binary);
+        file << text;
+        return path;
+    }
+}}}
+
+#endif
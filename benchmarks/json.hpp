@@ -0,0 +1,116 @@
+/**
+ * @file json.hpp
+ * @author Mohammed Ghaith Al-Mahdawi (Mohido)
+ * @brief Benchmarks yaml to JSON transcoding from the events against loading the tree and walking it, and JSON ingest.
+ */
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <filesystem>
+#include <string>
+#include <chrono>
+#include "../yaml/yaml.hpp"
+
+namespace TINY_YAML{
+namespace benchmarks {
+
+    #ifndef TINY_YAML_BENCHMARKS_HELPER_FUNCS
+    #define TINY_YAML_BENCHMARKS_HELPER_FUNCS
+        /// @brief - Runs the function `repeat` times and returns the best run in seconds.
+        template<typename F>
+        double bestOf(int repeat, F function){
+            double best = 1e30;
+            for (int i = 0; i < repeat; i++) {
+                auto start = std::chrono::steady_clock::now();
+                function();
+                double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                best = (elapsed < best) ? elapsed : best;
+            }
+            return best;
+        }
+
+        /// @brief - Prints the throughput of a benchmark.
+        void report(const std::string& name, std::size_t bytes, double seconds){
+            std::cout << "BENCH: " << name << ": " << (bytes / seconds) / (1024.0 * 1024.0) << " MB/s" << std::endl;
+        }
+    #endif
+
+    /// @brief - The way to JSON without the transcoder: replays a loaded tree as events into a JsonWriter.
+    void walkJson(const Node& node, JsonWriter& json){
+        for (const Node& child : node) {
+            if (node.getKind() == Node::Kind::Mapping)
+                json.key(child.getID());
+            if (child.getKind() == Node::Kind::Scalar)
+                json.scalar(child.getValue());
+            else {
+                if (child.getKind() == Node::Kind::Mapping)
+                    json.startMapping();
+                else
+                    json.startSequence();
+                walkJson(child, json);
+                json.end();
+            }
+        }
+    }
+
+    void bench_json(){
+        std::cout << "############# BENCHGROUP: bench_json" << std::endl;
+        std::filesystem::path path = std::filesystem::temp_directory_path() / "tiny_yaml_bench_json.yaml";
+
+        /*About 8 MB of records with mixed scalars*/
+        const int records = 60000;
+        {
+            std::ofstream file(path);
+            for (int i = 0; i < records; i++) {
+                file << "record_" << i << ":\n"
+                     << "  name: \"service " << i << "\"\n"
+                     << "  port: " << 1024 + i % 50000 << "\n"
+                     << "  ratio: " << i % 100 << ".25\n"
+                     << "  enabled: " << ((i % 2) ? "true" : "false") << "\n"
+                     << "  tags:\n    - alpha\n    - beta\n";
+            }
+        }
+        std::size_t bytes = std::filesystem::file_size(path);
+
+        std::string transcoded;
+        double streaming = bestOf(3, [&]() {
+            std::ifstream file(path, std::ios::binary);
+            std::ostringstream out;
+            std::string error;
+            JsonWriter::transcode(file, out, error);
+            transcoded = out.str();
+        });
+        report("yaml -> json, JsonWriter::transcode", bytes, streaming);
+
+        std::string walked;
+        double loadWalk = bestOf(3, [&]() {
+            Yaml yaml(path.string());
+            std::ostringstream out;
+            Writer writer(out);
+            JsonWriter json(writer);
+            json.startMapping();
+            for (int i = 0; i < records; i++) {
+                std::string key = "record_" + std::to_string(i);
+                json.key(key);
+                json.startMapping();
+                walkJson(yaml[key], json);
+                json.end();
+            }
+            json.end();
+            writer.flush();
+            walked = out.str();
+        });
+        report("yaml -> json, load + walk", bytes, loadWalk);
+        std::cout << "BENCH: same output: " << ((walked == transcoded) ? "yes" : "no") << std::endl;
+
+        /*JSON back into a tree*/
+        double ingest = bestOf(3, [&]() {
+            Yaml yaml;
+            yaml.parseJson(transcoded);
+        });
+        report("json -> tree, Yaml::parseJson", transcoded.size(), ingest);
+        std::filesystem::remove(path);
+        std::cout << "############################" << std::endl;
+    }
+}}
@@ -0,0 +1,208 @@
+/**
+ * @file load.hpp
+ * @author Mohammed Ghaith Al-Mahdawi (Mohido)
+ * @brief Benchmarks Yaml::load on the generated corpus (MB/s, nodes/s, peak RSS) and the latency percentiles of lookups.
+ */
+
+#include <iostream>
+#include <filesystem>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <chrono>
+#include "corpus.hpp"
+#include "../yaml/yaml.hpp"
+
+#if _WIN32
+    #include <windows.h>
+    #include <psapi.h>
+#else
+    #include <sys/resource.h>
+    #include <sys/wait.h>
+    #include <unistd.h>
+    #if __GLIBC__
+        #include <malloc.h>
+    #endif
+#endif
+
+namespace TINY_YAML{
+namespace benchmarks {
+
+    #ifndef TINY_YAML_BENCHMARKS_HELPER_FUNCS
+    #define TINY_YAML_BENCHMARKS_HELPER_FUNCS
+        /// @brief - Runs the function `repeat` times and returns the best run in seconds.
+        template<typename F>
+        double bestOf(int repeat, F function){
+            double best = 1e30;
+            for (int i = 0; i < repeat; i++) {
+                auto start = std::chrono::steady_clock::now();
+                function();
+                double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                best = (elapsed < best) ? elapsed : best;
+            }
+            return best;
+        }
+
+        /// @brief - Prints the throughput of a benchmark.
+        void report(const std::string& name, std::size_t bytes, double seconds){
+            std::cout << "BENCH: " << name << ": " << (bytes / seconds) / (1024.0 * 1024.0) << " MB/s" << std::endl;
+        }
+    #endif
+
+    /// @brief - Peak resident set size of the process so far, in MB.
+    double maxRssMB(){
+    #if _WIN32
+        PROCESS_MEMORY_COUNTERS counters;
+        if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+            return 0;
+        return counters.PeakWorkingSetSize / (1024.0 * 1024.0);
+    #else
+        struct rusage usage;
+        getrusage(RUSAGE_SELF, &usage);
+        #if __APPLE__
+            return usage.ru_maxrss / (1024.0 * 1024.0);      // bytes
+        #else
+            return usage.ru_maxrss / 1024.0;                 // kilobytes
+        #endif
+    #endif
+    }
+
+    /// @brief - Peak resident set size added by the function, in MB.
+    /// The peak is the one of the whole process, so on POSIX the function runs in a forked child: the child starts at the current
+    /// size of the parent, not at its peak, and earlier shapes do not count. Windows has no fork: the peak of this process is taken
+    /// over its working set before the call, which is only right if no earlier peak was higher.
+    template<typename F>
+    double peakRssMB(F function){
+    #if _WIN32
+        PROCESS_MEMORY_COUNTERS before;
+        if (!GetProcessMemoryInfo(GetCurrentProcess(), &before, sizeof(before)))
+            return 0;
+        function();
+        double peak = maxRssMB() - before.WorkingSetSize / (1024.0 * 1024.0);
+        return (peak > 0) ? peak : 0;
+    #else
+        int channel[2];
+        if (pipe(channel) != 0)
+            return 0;
+        pid_t child = fork();
+        if (child == 0) {
+            close(channel[0]);
+            #if __GLIBC__
+                malloc_trim(0);                                 // Free heap pages inherited from the parent would hide the first allocations
+            #endif
+            double baseline = maxRssMB();
+            function();
+            double peak = maxRssMB() - baseline;
+            ssize_t written = write(channel[1], &peak, sizeof(peak));
+            _exit(written == sizeof(peak) ? 0 : 1);
+        }
+        close(channel[1]);
+        double peak = 0;
+        if (child < 0 || read(channel[0], &peak, sizeof(peak)) != sizeof(peak))
+            peak = 0;
+        close(channel[0]);
+        if (child > 0)
+            waitpid(child, nullptr, 0);
+        return peak;
+    #endif
+    }
+
+    /// @brief - Number of nodes under the node (itself excluded).
+    std::size_t countNodes(const Node& node){
+        std::size_t count = node.getSize();
+        for (const Node& child : node)
+            count += countNodes(child);
+        return count;
+    }
+
+    /// @brief - Times batches of lookups and prints the p50/p90/p99 latency of one lookup.
+    template<typename F>
+    void percentiles(const std::string& name, int samples, F lookupBatch){
+        const int batch = 64;       // One lookup is below the clock resolution, the batch is timed and divided
+        std::vector<double> latencies;
+        latencies.reserve(samples);
+        for (int i = 0; i < samples; i++) {
+            auto start = std::chrono::steady_clock::now();
+            lookupBatch(i, batch);
+            latencies.push_back(std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / batch);
+        }
+        std::sort(latencies.begin(), latencies.end());
+        auto at = [&](double p) { return latencies[static_cast<std::size_t>(p * (latencies.size() - 1))]; };
+        std::cout << "BENCH: " << name << ": p50 " << at(0.50) << " ns, p90 " << at(0.90) << " ns, p99 " << at(0.99) << " ns" << std::endl;
+    }
+
+    void bench_load(){
+        std::cout << "############# BENCHGROUP: bench_load" << std::endl;
+
+        /*10 to 20 MB per shape, generated one at a time. The peak RSS of each load is measured on its own*/
+        std::vector<std::string> wideKeys;
+        struct Shape { std::string name; std::function<std::string()> generate; };
+        std::vector<Shape> shapes;
+        shapes.push_back({ "deep_nesting", []() { return corpus::deepNesting(2000, 64); } });
+        shapes.push_back({ "wide_mapping", [&]() { return corpus::wideMapping(500000, &wideKeys); } });
+        shapes.push_back({ "scalar_list", []() { return corpus::scalarList(1000000); } });
+        shapes.push_back({ "record_list", []() { return corpus::recordList(120000); } });
+        shapes.push_back({ "number_block", []() { return corpus::numberRows(1000, 1000, false); } });
+        shapes.push_back({ "number_flow", []() { return corpus::numberRows(1000, 1000, true); } });
+
+        for (Shape& shape : shapes) {
+            std::size_t bytes;
+            std::filesystem::path path;
+            {
+                std::string text = shape.generate();
+                bytes = text.size();
+                path = corpus::write(shape.name, text);
+            }
+
+            /*Only the load is timed, the nodes are counted on another load*/
+            double peak = peakRssMB([&]() {
+                Yaml yaml(path.string());
+            });
+            double seconds = bestOf(3, [&]() {
+                Yaml yaml(path.string());
+            });
+            Yaml yaml(path.string());
+            std::size_t nodes = countNodes(*yaml.compile(std::vector<std::string>()));
+            std::cout << "BENCH: load " << shape.name << ": " << (bytes / seconds) / (1024.0 * 1024.0) << " MB/s, "
+                      << nodes / seconds / 1e6 << " M nodes/s (" << nodes << " nodes), peak RSS " << peak << " MB" << std::endl;
+
+            /*Lookup latencies on the loaded tree*/
+            std::mt19937 random(42);
+            std::size_t checksum = 0;
+            if (shape.name == "wide_mapping") {
+                Node& map = yaml["map"];
+                percentiles("lookup map.<random key>", 20000, [&](int, int count) {
+                    for (int i = 0; i < count; i++)
+                        checksum += map[wideKeys[random() % wideKeys.size()]].getValue().size();
+                });
+            }
+            else if (shape.name == "record_list") {
+                Node& list = yaml["node_list"];
+                percentiles("lookup node_list[<random>][\"hell\"][1][\"item1\"]", 20000, [&](int, int count) {
+                    for (int i = 0; i < count; i++)
+                        checksum += list[random() % list.getSize()]["hell"][1]["item1"].getValue().size();
+                });
+            }
+            else if (shape.name == "scalar_list") {
+                Node& list = yaml["list"];
+                percentiles("lookup list[<random>]", 20000, [&](int, int count) {
+                    for (int i = 0; i < count; i++)
+                        checksum += list[random() % list.getSize()].getValue().size();
+                });
+            }
+            else if (shape.name == "deep_nesting") {
+                Path leaf = yaml.compile("chain_1999.level_1.level_2.level_3.level_4.level_5.level_6.level_7");
+                percentiles("compiled path chain_1999.level_1..7", 20000, [&](int, int count) {
+                    for (int i = 0; i < count; i++)
+                        checksum += leaf->getSize();
+                });
+            }
+            if (checksum != 0)
+                std::cout << "-- checksum: " << checksum << std::endl;
+            std::filesystem::remove(path);
+        }
+        std::cout << "############################" << std::endl;
+    }
+}}
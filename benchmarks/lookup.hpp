@@ -0,0 +1,104 @@
+/**
+ * @file lookup.hpp
+ * @author Mohammed Ghaith Al-Mahdawi (Mohido)
+ * @brief Benchmarks child lookups of the flat child list against the std::unordered_map<std::string, ...> it replaced.
+ */
+
+#include <iostream>
+#include <fstream>
+#include <filesystem>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <random>
+#include <chrono>
+#include "../yaml/yaml.hpp"
+
+namespace TINY_YAML{
+namespace benchmarks {
+
+    #ifndef TINY_YAML_BENCHMARKS_HELPER_FUNCS
+    #define TINY_YAML_BENCHMARKS_HELPER_FUNCS
+        /// @brief - Runs the function `repeat` times and returns the best run in seconds.
+        template<typename F>
+        double bestOf(int repeat, F function){
+            double best = 1e30;
+            for (int i = 0; i < repeat; i++) {
+                auto start = std::chrono::steady_clock::now();
+                function();
+                double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                best = (elapsed < best) ? elapsed : best;
+            }
+            return best;
+        }
+
+        /// @brief - Prints the throughput of a benchmark.
+        void report(const std::string& name, std::size_t bytes, double seconds){
+            std::cout << "BENCH: " << name << ": " << (bytes / seconds) / (1024.0 * 1024.0) << " MB/s" << std::endl;
+        }
+    #endif
+
+    void bench_lookup(){
+        std::cout << "############# BENCHGROUP: bench_lookup" << std::endl;
+        std::filesystem::path path = std::filesystem::temp_directory_path() / "tiny_yaml_bench_lookup.yaml";
+
+        for (int width : { 4, 16, 64, 256 }) {
+            /*One mapping with `width` keys*/
+            std::vector<std::string> keys;
+            {
+                std::ofstream file(path);
+                file << "map:\n";
+                for (int i = 0; i < width; i++) {
+                    keys.push_back("field_" + std::to_string(i * 7919 % 100000));
+                    file << "  " << keys.back() << ": " << i << "\n";
+                }
+            }
+            Yaml yaml(path.string());
+
+            /*What the lookups used to go through: a string keyed hash map, and a std::string built per lookup*/
+            std::unordered_map<std::string, Node*> reference;
+            for (const auto& key : keys)
+                reference[key] = &yaml["map"][key];
+
+            std::vector<const char*> order;
+            std::mt19937 random(42);
+            for (int i = 0; i < 1000000; i++)
+                order.push_back(keys[random() % keys.size()].c_str());
+
+            std::size_t checksum = 0;
+            Node& map = yaml["map"];
+            double flat = bestOf(5, [&]() {
+                for (const char* key : order)
+                    checksum += map[key].getValue().size();
+            });
+            double hashed = bestOf(5, [&]() {
+                for (const char* key : order)
+                    checksum += reference.find(std::string(key))->second->getValue().size();
+            });
+            std::cout << "BENCH: width " << width << ": ChildList " << flat * 1e9 / order.size() << " ns/lookup, "
+                      << "unordered_map<std::string> " << hashed * 1e9 / order.size() << " ns/lookup (checksum " << checksum << ")" << std::endl;
+        }
+
+        /*A three level chain looked up segment by segment, and through a compiled path*/
+        {
+            std::ofstream file(path);
+            file << "node_list:\n  - name: a\n  - name: b\n    extra: 1\n    other: 2\n";
+        }
+        Yaml yaml(path.string());
+        Path compiled = yaml.compile("node_list.1.extra");
+        std::size_t checksum = 0;
+        const int count = 1000000;
+        double chained = bestOf(5, [&]() {
+            for (int i = 0; i < count; i++)
+                checksum += yaml["node_list"]["1"]["extra"].getValue().size();
+        });
+        double precompiled = bestOf(5, [&]() {
+            for (int i = 0; i < count; i++)
+                checksum += compiled->getValue().size();
+        });
+        std::cout << "BENCH: node_list.1.extra: operator[] chain " << chained * 1e9 / count << " ns/lookup, "
+                  << "compiled path " << precompiled * 1e9 / count << " ns/lookup (checksum " << checksum << ")" << std::endl;
+        std::filesystem::remove(path);
+        std::cout << "############################" << std::endl;
+    }
+}}
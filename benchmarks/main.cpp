@@ -0,0 +1,28 @@
+#include "scanner.hpp"    // Benchmarks the structural character scanner
+#include "lookup.hpp"     // Benchmarks child lookups
+#include "json.hpp"       // Benchmarks JSON transcoding and ingest
+#include "load.hpp"       // Benchmarks loading the generated corpus
+#include "binding.hpp"    // Benchmarks binding documents to structs
+
+#include <cstring>
+
+
+int main(int argc, char** argv) {
+    /*`--filter=<text>` runs the groups whose name contains the text*/
+    std::string filter;
+    for (int i = 1; i < argc; i++) {
+        if (std::strncmp(argv[i], "--filter=", 9) == 0)
+            filter = argv[i] + 9;
+    }
+    auto run = [&](const std::string& name, void (*group)()) {
+        if (name.find(filter) != std::string::npos)
+            group();
+    };
+
+    run("bench_scanner", TINY_YAML::benchmarks::bench_scanner);
+    run("bench_lookup", TINY_YAML::benchmarks::bench_lookup);
+    run("bench_json", TINY_YAML::benchmarks::bench_json);
+    run("bench_load", TINY_YAML::benchmarks::bench_load);
+    run("bench_binding", TINY_YAML::benchmarks::bench_binding);
+    return 0;
+}
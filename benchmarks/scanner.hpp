@@ -0,0 +1,120 @@
+/**
+ * @file scanner.hpp
+ * @author Mohammed Ghaith Al-Mahdawi (Mohido)
+ * @brief Benchmarks the structural character scanner against the byte by byte classifier it replaced.
+ */
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include "../yaml/scanner.hpp"
+
+namespace TINY_YAML{
+namespace benchmarks {
+
+    #ifndef TINY_YAML_BENCHMARKS_HELPER_FUNCS
+    #define TINY_YAML_BENCHMARKS_HELPER_FUNCS
+        /// @brief - Runs the function `repeat` times and returns the best run in seconds.
+        template<typename F>
+        double bestOf(int repeat, F function){
+            double best = 1e30;
+            for (int i = 0; i < repeat; i++) {
+                auto start = std::chrono::steady_clock::now();
+                function();
+                double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                best = (elapsed < best) ? elapsed : best;
+            }
+            return best;
+        }
+
+        /// @brief - Prints the throughput of a benchmark.
+        void report(const std::string& name, std::size_t bytes, double seconds){
+            std::cout << "BENCH: " << name << ": " << (bytes / seconds) / (1024.0 * 1024.0) << " MB/s" << std::endl;
+        }
+    #endif
+
+    /// @brief - The per-line classifier of Yaml::load before the scanner existed (switch per byte + find passes).
+    bool scanLineReference(std::string_view lineContent, LineMarks& marks){
+        std::size_t hashPos = std::string::npos;
+        std::size_t fstQuotePos = std::string::npos;
+        std::size_t lstQuotePos = std::string::npos;
+        std::size_t dashPos = std::string::npos;
+        for (size_t i = 0; i < lineContent.length(); i++) {
+            char c = lineContent[i];
+            switch (c)
+            {
+            case '-':
+                if( !(fstQuotePos != std::string::npos && lstQuotePos == std::string::npos) && dashPos == std::string::npos)
+                    dashPos = i;
+                break;
+            case '#':
+                if( hashPos == std::string::npos && !(fstQuotePos != std::string::npos && lstQuotePos == std::string::npos))
+                    hashPos = i;
+                break;
+            case '\'':
+            case '\"':
+                if(hashPos == std::string::npos && (i == 0 || lineContent[i-1] != '\\')){
+                    if(fstQuotePos == std::string::npos)
+                        fstQuotePos = i;
+                    else if(lstQuotePos == std::string::npos && lineContent[fstQuotePos] == c)
+                        lstQuotePos = i;
+                }
+                break;
+            default:
+                break;
+            }
+        }
+        if(fstQuotePos != std::string::npos && lstQuotePos == std::string::npos)
+            return false;
+        if (hashPos != std::string::npos)
+            lineContent = lineContent.substr(0, hashPos);
+        marks.hash = hashPos;
+        marks.fstQuote = fstQuotePos;
+        marks.lstQuote = lstQuotePos;
+        marks.dash = dashPos;
+        marks.colon = lineContent.find(':');
+        marks.firstChar = lineContent.find_first_not_of(" -#\t\f\v\n\r");
+        marks.lastChar = lineContent.find_last_not_of(" #\t\f\v\n\r");
+        return true;
+    }
+
+    void bench_scanner(){
+        std::cout << "############# BENCHGROUP: bench_scanner" << std::endl;
+
+        /*Typical short yaml lines plus some long values*/
+        std::vector<std::string> lines;
+        for (int i = 0; i < 200000; i++) {
+            lines.push_back("  - name: \"node" + std::to_string(i) + "\"  # comment");
+            lines.push_back("    value: " + std::to_string(i));
+            lines.push_back("    extra:");
+            lines.push_back("      - extra" + std::to_string(i));
+            if (i % 50 == 0)
+                lines.push_back("    blob: '" + std::string(2000, 'x') + "'");
+        }
+        std::size_t bytes = 0;
+        for (const auto& line : lines)
+            bytes += line.size();
+
+        std::size_t checksum = 0;
+        auto run = [&](auto scan) {
+            return [&, scan]() {
+                LineMarks marks;
+                for (const auto& line : lines) {
+                    scan(line, marks);
+                    checksum += marks.lastChar;
+                }
+            };
+        };
+
+        report("reference (byte switch + find)", bytes, bestOf(5, run([](std::string_view line, LineMarks& marks) { return scanLineReference(line, marks); })));
+        ScanLevel best = detectScanLevel();
+        report("scanLine scalar", bytes, bestOf(5, run([](std::string_view line, LineMarks& marks) { return scanLine(line, marks, ScanLevel::Scalar); })));
+        if (best != ScanLevel::Scalar)
+            report("scanLine sse2", bytes, bestOf(5, run([](std::string_view line, LineMarks& marks) { return scanLine(line, marks, ScanLevel::SSE2); })));
+        if (best == ScanLevel::AVX2)
+            report("scanLine avx2", bytes, bestOf(5, run([](std::string_view line, LineMarks& marks) { return scanLine(line, marks, ScanLevel::AVX2); })));
+        std::cout << "-- BENCHGROUP bench_scanner checksum: " << checksum << std::endl;
+        std::cout << "############################" << std::endl;
+    }
+}}
@@ -0,0 +1,62 @@
+/**
+ * @file 10.hpp
+ * @author Mohammed Ghaith Al-Mahdawi (Mohido)
+ * @brief Tests the flat child list (document order, lookups, duplicated keys)
+ */
+
+ #include <iostream>
+ #include "../yaml/yaml.hpp"
+ 
+ namespace TINY_YAML{
+ namespace tests {
+ 
+     #ifndef TINY_YAML_TESTS_HELPER_FUNCS
+     #define TINY_YAML_TESTS_HELPER_FUNCS
+         template<typename T>
+         bool assert(T v1, T v2){
+             bool result = v1 == v2;
+             std::cout << "TEST: Value (" << v1 << ") Expected to be (" << v2 << ")? " << ((result)? "passed" : "failed") << std::endl;
+             return result;
+         }
+ 
+         /// @brief - Mainly used in compile time to get the absolute path of .hpp/.cpp file parent directory
+         /// @return - Directory absolutepath of the current file.
+         std::string dirpath(){
+             std::string hppfilepath(__FILE__);
+             #if _WIN32
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("\\"));
+             #else 
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("/"));
+             #endif
+         }
+     #endif
+ 
+     bool test_10_children(){
+         int passed = 0;
+         int total = 0;
+         std::cout << "############# TESTGROUP: test_children" << std::endl;
+         try{
+             Yaml yamlFile( dirpath() + std::string("/10.yaml"));
+             total++; passed += assert(yamlFile["wide"].getSize(), 40u);
+             total++; passed += assert(yamlFile["wide"]["key7"].getData<std::string>(), std::string("1"));
+             total++; passed += assert(yamlFile["wide"]["key33"].getData<std::string>(), std::string("39"));
+             total++; passed += assert(yamlFile["wide"].getChildren().find("key40") == nullptr, true);
+             total++; passed += assert(yamlFile["wide"].getChildren().begin()[2].key, std::string_view("key14"));
+             total++; passed += assert(yamlFile["small"].getChildren().begin()[0].key, std::string_view("b"));
+             total++; passed += assert(yamlFile["small"].getChildren().begin()[1].node->getValue(), std::string_view("1"));
+
+             bool thrown = false;
+             try { yamlFile["small"]["c"]; } catch (const std::out_of_range&) { thrown = true; }
+             total++; passed += assert(thrown, true);
+
+             Yaml duplicated;
+             total++; passed += assert(duplicated.load(dirpath() + std::string("/10_duplicate.yaml")), false);
+         }catch(const std::exception& e){
+             std::cerr << e.what() << std::endl;
+             return false;
+         }
+         std::cout << "-- TESTGROUP test_children RESULT: " << passed << " passed out of " << total << std::endl;
+         std::cout << "############################" << std::endl;
+         return true;
+     }
+ }}
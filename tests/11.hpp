@@ -0,0 +1,66 @@
+/**
+ * @file 11.hpp
+ * @author Mohammed Ghaith Al-Mahdawi (Mohido)
+ * @brief Tests pre-compiled paths
+ */
+
+ #include <iostream>
+ #include "../yaml/yaml.hpp"
+ 
+ namespace TINY_YAML{
+ namespace tests {
+ 
+     #ifndef TINY_YAML_TESTS_HELPER_FUNCS
+     #define TINY_YAML_TESTS_HELPER_FUNCS
+         template<typename T>
+         bool assert(T v1, T v2){
+             bool result = v1 == v2;
+             std::cout << "TEST: Value (" << v1 << ") Expected to be (" << v2 << ")? " << ((result)? "passed" : "failed") << std::endl;
+             return result;
+         }
+ 
+         /// @brief - Mainly used in compile time to get the absolute path of .hpp/.cpp file parent directory
+         /// @return - Directory absolutepath of the current file.
+         std::string dirpath(){
+             std::string hppfilepath(__FILE__);
+             #if _WIN32
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("\\"));
+             #else 
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("/"));
+             #endif
+         }
+     #endif
+ 
+     bool test_11_compiled_paths(){
+         int passed = 0;
+         int total = 0;
+         std::cout << "############# TESTGROUP: test_compiled_paths" << std::endl;
+         try{
+             Yaml yamlFile( dirpath() + std::string("/11.yaml"));
+             Path name = yamlFile.compile("node_list.1.name");
+             Path port = yamlFile.compile("config.port");
+             Path dotted = yamlFile.compile(std::vector<std::string>{ "config", "server.name" });
+             Path missing = yamlFile.compile("config.missing");
+             total++; passed += assert(name->getValue(), std::string_view("\"second\""));
+             total++; passed += assert(name.get() == &yamlFile["node_list"]["1"]["name"], true);
+             total++; passed += assert((*port).as<int>(), 8080);
+             total++; passed += assert(dotted->getValue(), std::string_view("\"dotted key\""));
+             total++; passed += assert(missing.get() == nullptr, true);
+
+             // Loading again releases the nodes, the paths resolve into the new document.
+             yamlFile.load(dirpath() + std::string("/5.yaml"));
+             total++; passed += assert(name->getValue(), std::string_view("\"node2\""));
+             total++; passed += assert(port.get() == nullptr, true);
+
+             bool thrown = false;
+             try { *port; } catch (const std::out_of_range&) { thrown = true; }
+             total++; passed += assert(thrown, true);
+         }catch(const std::exception& e){
+             std::cerr << e.what() << std::endl;
+             return false;
+         }
+         std::cout << "-- TESTGROUP test_compiled_paths RESULT: " << passed << " passed out of " << total << std::endl;
+         std::cout << "############################" << std::endl;
+         return true;
+     }
+ }}
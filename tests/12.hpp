@@ -0,0 +1,78 @@
+/**
+ * @file 12.hpp
+ * @author Mohammed Ghaith Al-Mahdawi (Mohido)
+ * @brief Tests sequence nodes (index access, iteration, scalar and mapping items)
+ */
+
+ #include <iostream>
+ #include "../yaml/yaml.hpp"
+ 
+ namespace TINY_YAML{
+ namespace tests {
+ 
+     #ifndef TINY_YAML_TESTS_HELPER_FUNCS
+     #define TINY_YAML_TESTS_HELPER_FUNCS
+         template<typename T>
+         bool assert(T v1, T v2){
+             bool result = v1 == v2;
+             std::cout << "TEST: Value (" << v1 << ") Expected to be (" << v2 << ")? " << ((result)? "passed" : "failed") << std::endl;
+             return result;
+         }
+ 
+         /// @brief - Mainly used in compile time to get the absolute path of .hpp/.cpp file parent directory
+         /// @return - Directory absolutepath of the current file.
+         std::string dirpath(){
+             std::string hppfilepath(__FILE__);
+             #if _WIN32
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("\\"));
+             #else 
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("/"));
+             #endif
+         }
+     #endif
+ 
+     bool test_12_sequences(){
+         int passed = 0;
+         int total = 0;
+         std::cout << "############# TESTGROUP: test_sequences" << std::endl;
+         try{
+             LoadOptions options;
+             options.resolveScalars = true;
+             Yaml yamlFile( dirpath() + std::string("/12.yaml"), options);
+             total++; passed += assert(yamlFile["numbers"].getKind() == Node::Kind::Sequence, true);
+             total++; passed += assert(yamlFile["numbers"].getSize(), 3u);
+             total++; passed += assert(yamlFile["numbers"][2].as<int>(), 3);
+
+             std::int64_t sum = 0;
+             for (const Node& item : yamlFile["numbers"])
+                 sum += item.as<std::int64_t>();
+             total++; passed += assert(sum, std::int64_t(6));
+
+             total++; passed += assert(yamlFile["mixed"].getSize(), 3u);
+             total++; passed += assert(yamlFile["mixed"][0].getValue(), std::string_view("plain"));
+             total++; passed += assert(yamlFile["mixed"][1].getKind() == Node::Kind::Mapping, true);
+             total++; passed += assert(yamlFile["mixed"][1]["value"].as<int>(), 5);
+             total++; passed += assert(yamlFile["mixed"]["1"]["name"].as<std::string_view>(), std::string_view("node"));
+             total++; passed += assert(yamlFile["mixed"][2].as<int>(), -7);
+
+             total++; passed += assert(yamlFile["unindented"].getSize(), 2u);
+             total++; passed += assert(yamlFile["unindented"][1].getValue(), std::string_view("b"));
+             total++; passed += assert(yamlFile["items"].getSize(), 2u);
+             total++; passed += assert(yamlFile["items"][0]["extra"][0].getValue(), std::string_view("e1"));
+             total++; passed += assert(yamlFile["items"][1]["name"].getValue(), std::string_view("y"));
+
+             bool thrown = false;
+             try { yamlFile["numbers"][3]; } catch (const std::out_of_range&) { thrown = true; }
+             total++; passed += assert(thrown, true);
+
+             Yaml invalid;
+             total++; passed += assert(invalid.load(dirpath() + std::string("/12_invalid.yaml")), false);
+         }catch(const std::exception& e){
+             std::cerr << e.what() << std::endl;
+             return false;
+         }
+         std::cout << "-- TESTGROUP test_sequences RESULT: " << passed << " passed out of " << total << std::endl;
+         std::cout << "############################" << std::endl;
+         return true;
+     }
+ }}
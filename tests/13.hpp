@@ -0,0 +1,78 @@
+/**
+ * @file 13.hpp
+ * @author Mohammed Ghaith Al-Mahdawi (Mohido)
+ * @brief Tests loading many files concurrently
+ */
+
+ #include <iostream>
+ #include "../yaml/yaml.hpp"
+ 
+ namespace TINY_YAML{
+ namespace tests {
+ 
+     #ifndef TINY_YAML_TESTS_HELPER_FUNCS
+     #define TINY_YAML_TESTS_HELPER_FUNCS
+         template<typename T>
+         bool assert(T v1, T v2){
+             bool result = v1 == v2;
+             std::cout << "TEST: Value (" << v1 << ") Expected to be (" << v2 << ")? " << ((result)? "passed" : "failed") << std::endl;
+             return result;
+         }
+ 
+         /// @brief - Mainly used in compile time to get the absolute path of .hpp/.cpp file parent directory
+         /// @return - Directory absolutepath of the current file.
+         std::string dirpath(){
+             std::string hppfilepath(__FILE__);
+             #if _WIN32
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("\\"));
+             #else 
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("/"));
+             #endif
+         }
+     #endif
+ 
+     bool test_13_load_many(){
+         int passed = 0;
+         int total = 0;
+         std::cout << "############# TESTGROUP: test_load_many" << std::endl;
+         try{
+             /*Valid files repeated many times, with a broken and a missing file in the middle*/
+             std::vector<std::string> filepaths;
+             for (int i = 0; i < 50; i++)
+                 filepaths.push_back(dirpath() + "/" + std::to_string(1 + i % 5) + ".yaml");
+             filepaths[17] = dirpath() + std::string("/12_invalid.yaml");
+             filepaths[33] = dirpath() + std::string("/missing.yaml");
+
+             std::vector<LoadResult> results = Yaml::loadMany(filepaths, 4);
+             total++; passed += assert(results.size(), filepaths.size());
+
+             int loaded = 0;
+             bool ordered = true;
+             for (std::size_t i = 0; i < results.size(); i++) {
+                 loaded += results[i].ok();
+                 ordered = ordered && results[i].filepath == filepaths[i];
+             }
+             total++; passed += assert(loaded, 48);
+             total++; passed += assert(ordered, true);
+             total++; passed += assert(results[17].ok(), false);
+             total++; passed += assert(results[17].error.empty(), false);
+             total++; passed += assert(results[33].ok(), false);
+             total++; passed += assert(results[33].error.find("cannot be opened") != std::string::npos, true);
+             total++; passed += assert(results[10].error.empty(), true);
+             total++; passed += assert((*results[0].yaml)["age"].getData<std::string>(), std::string("123"));
+             total++; passed += assert((*results[49].yaml)["node_list"]["0"]["value"].getData<std::string>(), std::string("1"));
+
+             /*More threads than files, and the default thread count*/
+             std::vector<LoadResult> single = Yaml::loadMany({ filepaths[0] }, 8);
+             total++; passed += assert(single.size() == 1 && single[0].ok(), true);
+             total++; passed += assert(Yaml::loadMany(filepaths).size(), filepaths.size());
+             total++; passed += assert(Yaml::loadMany({}).empty(), true);
+         }catch(const std::exception& e){
+             std::cerr << e.what() << std::endl;
+             return false;
+         }
+         std::cout << "-- TESTGROUP test_load_many RESULT: " << passed << " passed out of " << total << std::endl;
+         std::cout << "############################" << std::endl;
+         return true;
+     }
+ }}
@@ -0,0 +1,117 @@
+/**
+ * @file 14.hpp
+ * @author Mohammed Ghaith Al-Mahdawi (Mohido)
+ * @brief Tests parsing one big document on several threads
+ */
+
+ #include <iostream>
+ #include <fstream>
+ #include <cstdio>
+ #include <sstream>
+ #include "../yaml/yaml.hpp"
+ 
+ namespace TINY_YAML{
+ namespace tests {
+ 
+     #ifndef TINY_YAML_TESTS_HELPER_FUNCS
+     #define TINY_YAML_TESTS_HELPER_FUNCS
+         template<typename T>
+         bool assert(T v1, T v2){
+             bool result = v1 == v2;
+             std::cout << "TEST: Value (" << v1 << ") Expected to be (" << v2 << ")? " << ((result)? "passed" : "failed") << std::endl;
+             return result;
+         }
+ 
+         /// @brief - Mainly used in compile time to get the absolute path of .hpp/.cpp file parent directory
+         /// @return - Directory absolutepath of the current file.
+         std::string dirpath(){
+             std::string hppfilepath(__FILE__);
+             #if _WIN32
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("\\"));
+             #else 
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("/"));
+             #endif
+         }
+     #endif
+ 
+     bool test_14_parallel_load(){
+         int passed = 0;
+         int total = 0;
+         std::cout << "############# TESTGROUP: test_parallel_load" << std::endl;
+         try{
+             /*A document big enough to be split into several chunks*/
+             std::string filepath = dirpath() + std::string("/14_generated.yaml");
+             std::string broken = dirpath() + std::string("/14_generated_duplicate.yaml");
+             std::string document;
+             for (int i = 0; i < 40000; i++) {
+                 document += "# entry " + std::to_string(i) + "\n";
+                 document += "entry" + std::to_string(i) + ":\n  id: " + std::to_string(i) + "\n  name: \"item " + std::to_string(i) + "\"\n";
+                 document += "  tags:\n  - a\n  - b\n";
+             }
+             document += "root_list:\n- x\n- y\nlast: end\nentry7: ignored\nentry8: [ignored, too]\n";
+             std::ofstream(filepath, std::ios_base::binary) << document;
+             std::ofstream(broken, std::ios_base::binary) << document << "entry39990:\n  id: 0\n";
+
+             LoadOptions options;
+             options.threads = 4;
+             options.resolveScalars = true;
+             Yaml parallel(filepath, options);
+             Yaml sequential(filepath);
+             total++; passed += assert(parallel["entry0"]["id"].as<int>(), 0);
+             total++; passed += assert(parallel["entry39999"]["id"].as<int>(), 39999);
+             total++; passed += assert(parallel["entry21234"]["name"].as<std::string_view>(), std::string_view("item 21234"));
+             total++; passed += assert(parallel["entry21234"]["tags"][1].getValue(), std::string_view("b"));
+             total++; passed += assert(parallel["entry7"]["id"].as<int>(), 7);
+             total++; passed += assert(parallel["entry8"]["id"].as<int>(), 8);
+             total++; passed += assert(parallel["root_list"].getSize(), 2u);
+             total++; passed += assert(parallel["last"].getValue(), std::string_view("end"));
+
+             /*Same result as a single pass*/
+             bool same = true;
+             for (int i = 0; i < 40000; i += 997) {
+                 std::string key = "entry" + std::to_string(i);
+                 same = same && parallel[key]["name"].getValue() == sequential[key]["name"].getValue();
+                 same = same && parallel[key]["tags"].getSize() == sequential[key]["tags"].getSize();
+             }
+             total++; passed += assert(same, true);
+
+             Yaml mapped;
+             total++; passed += assert(mapped.loadMapped(filepath, options), true);
+             total++; passed += assert(mapped["entry30001"]["tags"][0].getValue(), std::string_view("a"));
+
+             /*A duplicated root parent late in the document is still found, at the same line*/
+             Yaml duplicated;
+             Yaml duplicatedSequential;
+             total++; passed += assert(duplicated.load(broken, options), false);
+             total++; passed += assert(duplicatedSequential.load(broken), false);
+             total++; passed += assert(duplicated.getError(), duplicatedSequential.getError());
+
+             /*Quoted root keys are unquoted: their duplicates are found too, even with escapes (the key is not a view into the document then)*/
+             for (std::string quoted : { std::string("\"entry39990\""), std::string("\"tab\\tkey\"") }) {
+                 const std::string text = "\"tab\\tkey\": 1\n" + document + "'entry5': ignored\n" + quoted + ":\n  id: 0\n";
+                 Yaml quotedParallel;
+                 Yaml quotedSequential;
+                 total++; passed += assert(quotedParallel.parse(text, options), false);
+                 total++; passed += assert(quotedSequential.parse(text), false);
+                 total++; passed += assert(quotedParallel.getError(), quotedSequential.getError());
+             }
+
+             /*Documents of a stream are split too*/
+             std::istringstream stream("---\n" + document + "---\nid: 2\n");
+             DocumentStream documents(stream);
+             Yaml streamed;
+             total++; passed += assert(documents.next(streamed, options) && streamed["entry39999"]["id"].as<int>() == 39999, true);
+             total++; passed += assert(streamed["entry8"]["id"].as<int>(), 8);
+             total++; passed += assert(documents.next(streamed, options) && streamed["id"].as<int>() == 2, true);
+
+             std::remove(filepath.c_str());
+             std::remove(broken.c_str());
+         }catch(const std::exception& e){
+             std::cerr << e.what() << std::endl;
+             return false;
+         }
+         std::cout << "-- TESTGROUP test_parallel_load RESULT: " << passed << " passed out of " << total << std::endl;
+         std::cout << "############################" << std::endl;
+         return true;
+     }
+ }}
@@ -0,0 +1,75 @@
+/**
+ * @file 15.hpp
+ * @author Mohammed Ghaith Al-Mahdawi (Mohido)
+ * @brief Tests parsing documents from memory and from streams
+ */
+
+ #include <iostream>
+ #include <sstream>
+ #include "../yaml/yaml.hpp"
+ 
+ namespace TINY_YAML{
+ namespace tests {
+ 
+     #ifndef TINY_YAML_TESTS_HELPER_FUNCS
+     #define TINY_YAML_TESTS_HELPER_FUNCS
+         template<typename T>
+         bool assert(T v1, T v2){
+             bool result = v1 == v2;
+             std::cout << "TEST: Value (" << v1 << ") Expected to be (" << v2 << ")? " << ((result)? "passed" : "failed") << std::endl;
+             return result;
+         }
+ 
+         /// @brief - Mainly used in compile time to get the absolute path of .hpp/.cpp file parent directory
+         /// @return - Directory absolutepath of the current file.
+         std::string dirpath(){
+             std::string hppfilepath(__FILE__);
+             #if _WIN32
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("\\"));
+             #else 
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("/"));
+             #endif
+         }
+     #endif
+ 
+     bool test_15_memory_sources(){
+         int passed = 0;
+         int total = 0;
+         std::cout << "############# TESTGROUP: test_memory_sources" << std::endl;
+         try{
+             const std::string text = "object:\n  name: \"mohido\"\nlist:\n  - item1\n  - item2\nversion: 123";
+
+             /*Parsed in place, the values point into the text*/
+             Yaml parsed;
+             total++; passed += assert(parsed.parse(text), true);
+             total++; passed += assert(parsed["object"]["name"].getValue(), std::string_view("\"mohido\""));
+             total++; passed += assert(parsed["list"][1].getValue().data() >= text.data() && parsed["list"][1].getValue().data() < text.data() + text.size(), true);
+             total++; passed += assert(parsed["version"].getData<std::string>(), std::string("123"));
+
+             /*Any stream, with a single worker or several*/
+             std::istringstream stream(text);
+             Yaml streamed;
+             total++; passed += assert(streamed.load(stream), true);
+             total++; passed += assert(streamed["list"][0].getValue(), std::string_view("item1"));
+
+             LoadOptions options;
+             options.threads = 2;
+             options.resolveScalars = true;
+             std::istringstream parallelStream(text);
+             Yaml parallel;
+             total++; passed += assert(parallel.load(parallelStream, options), true);
+             total++; passed += assert(parallel["version"].as<int>(), 123);
+
+             Yaml invalid;
+             total++; passed += assert(invalid.parse("a: 1\n  - b\n"), false);
+             total++; passed += assert(invalid.getError(), std::string("invalid yaml syntax at line: 2"));
+             total++; passed += assert(invalid.parse(std::string_view()), true);
+         }catch(const std::exception& e){
+             std::cerr << e.what() << std::endl;
+             return false;
+         }
+         std::cout << "-- TESTGROUP test_memory_sources RESULT: " << passed << " passed out of " << total << std::endl;
+         std::cout << "############################" << std::endl;
+         return true;
+     }
+ }}
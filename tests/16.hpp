@@ -0,0 +1,92 @@
+/**
+ * @file 16.hpp
+ * @author Mohammed Ghaith Al-Mahdawi (Mohido)
+ * @brief Tests the push parser events
+ */
+
+ #include <iostream>
+ #include <fstream>
+ #include <iterator>
+ #include "../yaml/yaml.hpp"
+ 
+ namespace TINY_YAML{
+ namespace tests {
+ 
+     #ifndef TINY_YAML_TESTS_HELPER_FUNCS
+     #define TINY_YAML_TESTS_HELPER_FUNCS
+         template<typename T>
+         bool assert(T v1, T v2){
+             bool result = v1 == v2;
+             std::cout << "TEST: Value (" << v1 << ") Expected to be (" << v2 << ")? " << ((result)? "passed" : "failed") << std::endl;
+             return result;
+         }
+ 
+         /// @brief - Mainly used in compile time to get the absolute path of .hpp/.cpp file parent directory
+         /// @return - Directory absolutepath of the current file.
+         std::string dirpath(){
+             std::string hppfilepath(__FILE__);
+             #if _WIN32
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("\\"));
+             #else 
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("/"));
+             #endif
+         }
+     #endif
+ 
+     /// @brief - Writes the events as text: { } for mappings, [ ] for sequences, k= for keys and the scalars.
+     class EventRecorder : public EventHandler {
+     public:
+         std::string text;
+         void startMapping() override { text += "{"; }
+         void startSequence() override { text += "["; }
+         void end() override { text += "}"; }
+         void key(std::string_view key) override { text += std::string(key) + "="; }
+         void scalar(std::string_view value) override { text += "'" + std::string(value) + "' "; }
+     };
+
+     bool test_16_events(){
+         int passed = 0;
+         int total = 0;
+         std::cout << "############# TESTGROUP: test_events" << std::endl;
+         try{
+             std::ifstream file(dirpath() + std::string("/5.yaml"), std::ios_base::binary);
+             std::string document((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+             const std::string expected = "{node_list=[{name='\"node1\"' value='1' hell=[{item1='\"sang\"' }{item1='\"mang\"' }}}"
+                 "{name='\"node2\"' value='2' temp='extra' extra=['extra1' 'extra2' 'extra3' }}}}";
+
+             /*Whole document at once, then cut into small chunks (lines are split between feeds)*/
+             EventRecorder whole;
+             EventParser wholeParser(whole);
+             total++; passed += assert(wholeParser.feed(document) && wholeParser.finish(), true);
+             total++; passed += assert(whole.text, expected);
+
+             EventRecorder chunked;
+             EventParser chunkedParser(chunked);
+             bool ok = true;
+             for (std::size_t i = 0; i < document.size(); i += 7)
+                 ok = ok && chunkedParser.feed(std::string_view(document).substr(i, 7));
+             total++; passed += assert(ok && chunkedParser.finish(), true);
+             total++; passed += assert(chunked.text, expected);
+
+             /*Keys without value, comments, and reuse for a second document*/
+             chunked.text.clear();
+             total++; passed += assert(chunkedParser.feed("a:\n# comment\nb: 1\nc:\n  d:\n") && chunkedParser.finish(), true);
+             total++; passed += assert(chunked.text, std::string("{a='' b='1' c={d='' }}"));
+
+             /*Errors stop the parser until the next document*/
+             EventRecorder broken;
+             EventParser brokenParser(broken);
+             total++; passed += assert(brokenParser.feed("a: 1\n- b\n"), false);
+             total++; passed += assert(brokenParser.getError(), std::string("invalid yaml syntax at line: 2"));
+             total++; passed += assert(brokenParser.finish(), false);
+             total++; passed += assert(brokenParser.feed("x: \"unclosed\n"), false);
+             total++; passed += assert(brokenParser.getError(), std::string("invalid yaml syntax at line: 1"));
+         }catch(const std::exception& e){
+             std::cerr << e.what() << std::endl;
+             return false;
+         }
+         std::cout << "-- TESTGROUP test_events RESULT: " << passed << " passed out of " << total << std::endl;
+         std::cout << "############################" << std::endl;
+         return true;
+     }
+ }}
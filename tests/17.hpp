@@ -0,0 +1,114 @@
+/**
+ * @file 17.hpp
+ * @author Mohammed Ghaith Al-Mahdawi (Mohido)
+ * @brief Tests reading streams of many documents
+ */
+
+ #include <iostream>
+ #include <sstream>
+ #include "../yaml/yaml.hpp"
+ 
+ namespace TINY_YAML{
+ namespace tests {
+ 
+     #ifndef TINY_YAML_TESTS_HELPER_FUNCS
+     #define TINY_YAML_TESTS_HELPER_FUNCS
+         template<typename T>
+         bool assert(T v1, T v2){
+             bool result = v1 == v2;
+             std::cout << "TEST: Value (" << v1 << ") Expected to be (" << v2 << ")? " << ((result)? "passed" : "failed") << std::endl;
+             return result;
+         }
+ 
+         /// @brief - Mainly used in compile time to get the absolute path of .hpp/.cpp file parent directory
+         /// @return - Directory absolutepath of the current file.
+         std::string dirpath(){
+             std::string hppfilepath(__FILE__);
+             #if _WIN32
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("\\"));
+             #else 
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("/"));
+             #endif
+         }
+     #endif
+ 
+     bool test_17_documents(){
+         int passed = 0;
+         int total = 0;
+         std::cout << "############# TESTGROUP: test_documents" << std::endl;
+         try{
+             std::istringstream stream(
+                 "# leading comment\n"
+                 "---\n"
+                 "id: 1\n"
+                 "list:\n"
+                 "  - a\n"
+                 "---\n"
+                 "id: 2\n"
+                 "...\n"
+                 "---\n"
+                 "id: 3\n"
+                 "  - broken\n"
+                 "name: skipped\n"
+                 "---\n"
+                 "---\n"
+                 "id: 5\n");
+
+             DocumentStream documents(stream);
+             Yaml document;
+             total++; passed += assert(documents.next(document), true);
+             total++; passed += assert(document["id"].getValue(), std::string_view("1"));
+             total++; passed += assert(document["list"][0].getValue(), std::string_view("a"));
+             total++; passed += assert(documents.next(document), true);
+             total++; passed += assert(document["id"].getValue(), std::string_view("2"));
+             total++; passed += assert(document.compile("list").get() == nullptr, true);
+             total++; passed += assert(documents.next(document), true);
+             total++; passed += assert(document.getError(), std::string("invalid yaml syntax at line: 11"));
+             total++; passed += assert(documents.next(document), true);
+             total++; passed += assert(document.getError().empty() && document.compile("id").get() == nullptr, true);
+             total++; passed += assert(documents.next(document), true);
+             total++; passed += assert(document["id"].getValue(), std::string_view("5"));
+             total++; passed += assert(documents.next(document), false);
+
+             /*Lazy and parallel parses of the same stream: the documents are gathered first, the lines keep their numbers*/
+             LoadOptions lazy;
+             lazy.lazy = true;
+             LoadOptions parallel;
+             parallel.threads = 4;
+             parallel.resolveScalars = true;
+             for (const LoadOptions& options : { lazy, parallel }) {
+                 stream.clear();
+                 stream.seekg(0);
+                 DocumentStream gathered(stream);
+                 total++; passed += assert(gathered.next(document, options) && document["list"][0].getValue() == "a", true);
+                 total++; passed += assert(gathered.next(document, options) && document["id"].getScalar().type() == (options.resolveScalars ? Value::Type::Int : Value::Type::Raw), true);
+                 total++; passed += assert(gathered.next(document, options) && document.getError() == "invalid yaml syntax at line: 11", true);
+                 total++; passed += assert(gathered.next(document, options) && document.getError().empty() && document.compile("id").get() == nullptr, true);
+                 total++; passed += assert(gathered.next(document, options) && document["id"].as<int>() == 5, true);
+                 total++; passed += assert(gathered.next(document, options), false);
+             }
+
+             /*A document without any marker*/
+             DocumentStream single(dirpath() + std::string("/1.yaml"));
+             total++; passed += assert(single.next(document) && single.getError().empty(), true);
+             total++; passed += assert(document["age"].getData<std::string>(), std::string("123"));
+             total++; passed += assert(single.next(document), false);
+
+             DocumentStream missing(dirpath() + std::string("/missing.yaml"));
+             total++; passed += assert(missing.getError().empty() || missing.next(document), false);
+
+             /*Rewinding keeps the current block for the next allocations*/
+             Arena arena;
+             void* first = arena.allocate(64, 8);
+             std::size_t reserved = arena.reserved();
+             arena.rewind();
+             total++; passed += assert(arena.allocate(64, 8) == first && arena.reserved() == reserved, true);
+         }catch(const std::exception& e){
+             std::cerr << e.what() << std::endl;
+             return false;
+         }
+         std::cout << "-- TESTGROUP test_documents RESULT: " << passed << " passed out of " << total << std::endl;
+         std::cout << "############################" << std::endl;
+         return true;
+     }
+ }}
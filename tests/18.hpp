@@ -0,0 +1,86 @@
+/**
+ * @file 18.hpp
+ * @author Mohammed Ghaith Al-Mahdawi (Mohido)
+ * @brief Tests lazy loading of the root keys
+ */
+
+ #include <iostream>
+ #include <thread>
+ #include <atomic>
+ #include "../yaml/yaml.hpp"
+ 
+ namespace TINY_YAML{
+ namespace tests {
+ 
+     #ifndef TINY_YAML_TESTS_HELPER_FUNCS
+     #define TINY_YAML_TESTS_HELPER_FUNCS
+         template<typename T>
+         bool assert(T v1, T v2){
+             bool result = v1 == v2;
+             std::cout << "TEST: Value (" << v1 << ") Expected to be (" << v2 << ")? " << ((result)? "passed" : "failed") << std::endl;
+             return result;
+         }
+ 
+         /// @brief - Mainly used in compile time to get the absolute path of .hpp/.cpp file parent directory
+         /// @return - Directory absolutepath of the current file.
+         std::string dirpath(){
+             std::string hppfilepath(__FILE__);
+             #if _WIN32
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("\\"));
+             #else 
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("/"));
+             #endif
+         }
+     #endif
+ 
+     bool test_18_lazy_load(){
+         int passed = 0;
+         int total = 0;
+         std::cout << "############# TESTGROUP: test_lazy_load" << std::endl;
+         try{
+             LoadOptions options;
+             options.lazy = true;
+             Yaml lazy(dirpath() + std::string("/5.yaml"), options);
+             total++; passed += assert(lazy["node_list"].getKind() == Node::Kind::Sequence, true);
+             total++; passed += assert(lazy["node_list"][1]["extra"][2].getValue(), std::string_view("extra3"));
+             total++; passed += assert(lazy["node_list"]["0"]["hell"][1]["item1"].getData<std::string>(), std::string("\"mang\""));
+
+             const std::string text = "# header\nversion: 123\nobject:\n  name: x\n\n  list:\n  - a\n  - b\nroot_list:\n- 1\n- 2\nbroken:\n  a: 1\n  - b\nlast: end\n";
+             Yaml parsed;
+             total++; passed += assert(parsed.parse(text, options), true);
+             total++; passed += assert(parsed["version"].getValue(), std::string_view("123"));
+             total++; passed += assert(parsed["last"].getValue(), std::string_view("end"));
+             total++; passed += assert(parsed.compile("object.list.1").get()->getValue(), std::string_view("b"));
+             total++; passed += assert(parsed["root_list"].getSize(), 2u);
+
+             /*Errors below a root key show up when it is reached*/
+             std::string error;
+             try { parsed["broken"]["a"]; } catch (const std::runtime_error& e) { error = e.what(); }
+             total++; passed += assert(error, std::string("ERROR: Yaml Parser: invalid yaml syntax at line: 14"));
+
+             /*Duplicated roots are still found while loading*/
+             Yaml duplicated;
+             total++; passed += assert(duplicated.parse("a:\n  b: 1\na:\n  c: 2\n", options), false);
+
+             /*Concurrent readers reaching the same key parse it once*/
+             std::string wide = "wide:\n";
+             for (int i = 0; i < 2000; i++)
+                 wide += "  key" + std::to_string(i) + ": " + std::to_string(i) + "\n";
+             Yaml shared;
+             shared.parse(wide, options);
+             std::vector<std::thread> readers;
+             std::atomic<int> found{ 0 };
+             for (int t = 0; t < 4; t++)
+                 readers.emplace_back([&]() { found += shared["wide"].getSize() == 2000 && shared["wide"]["key1999"].getValue() == "1999"; });
+             for (std::thread& reader : readers)
+                 reader.join();
+             total++; passed += assert(found.load(), 4);
+         }catch(const std::exception& e){
+             std::cerr << e.what() << std::endl;
+             return false;
+         }
+         std::cout << "-- TESTGROUP test_lazy_load RESULT: " << passed << " passed out of " << total << std::endl;
+         std::cout << "############################" << std::endl;
+         return true;
+     }
+ }}
@@ -0,0 +1,102 @@
+/**
+ * @file 19.hpp
+ * @author Mohammed Ghaith Al-Mahdawi (Mohido)
+ * @brief Tests reloading a file into snapshots
+ */
+
+ #include <iostream>
+ #include <fstream>
+ #include <cstdio>
+ #include <vector>
+ #include "../yaml/yaml.hpp"
+ 
+ namespace TINY_YAML{
+ namespace tests {
+ 
+     #ifndef TINY_YAML_TESTS_HELPER_FUNCS
+     #define TINY_YAML_TESTS_HELPER_FUNCS
+         template<typename T>
+         bool assert(T v1, T v2){
+             bool result = v1 == v2;
+             std::cout << "TEST: Value (" << v1 << ") Expected to be (" << v2 << ")? " << ((result)? "passed" : "failed") << std::endl;
+             return result;
+         }
+ 
+         /// @brief - Mainly used in compile time to get the absolute path of .hpp/.cpp file parent directory
+         /// @return - Directory absolutepath of the current file.
+         std::string dirpath(){
+             std::string hppfilepath(__FILE__);
+             #if _WIN32
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("\\"));
+             #else 
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("/"));
+             #endif
+         }
+     #endif
+ 
+     bool test_19_reload(){
+         int passed = 0;
+         int total = 0;
+         std::cout << "############# TESTGROUP: test_reload" << std::endl;
+         try{
+             std::string filepath = dirpath() + std::string("/19_generated.yaml");
+             std::ofstream(filepath, std::ios_base::binary) << "server:\n  host: a\n  port: 80\nlimits:\n  cpu: 2\n  mem: 4\nlist:\n  - x\n  - y\nold: 1\n";
+             LiveYaml live(filepath);
+             std::shared_ptr<Yaml> first = live.snapshot();
+             Node* limits = &(*first)["limits"];
+             Node* host = &(*first)["server"]["host"];
+
+             /*Unchanged subtrees keep their nodes, the old snapshot stays readable*/
+             std::ofstream(filepath, std::ios_base::binary) << "server:\n  host: a\n  port: 8080\nlimits:\n  cpu: 2\n  mem: 4\nlist:\n  - x\n  - z\n  - w\nnew: 2\n";
+             std::vector<Change> changes;
+             total++; passed += assert(live.reload(changes), true);
+             std::string report;
+             for (const Change& change : changes)
+                 report += change.path + ":" + std::to_string(static_cast<int>(change.type)) + " ";
+             total++; passed += assert(report, std::string("server.port:2 list.1:2 list.2:0 new:0 old:1 "));
+             std::shared_ptr<Yaml> second = live.snapshot();
+             total++; passed += assert(second != first, true);
+             total++; passed += assert(&(*second)["limits"] == limits, true);
+             total++; passed += assert(&(*second)["server"]["host"] == host, true);
+             total++; passed += assert((*second)["server"]["port"].getValue(), std::string_view("8080"));
+             total++; passed += assert((*first)["server"]["port"].getValue(), std::string_view("80"));
+
+             /*Nothing changed: nothing is published*/
+             total++; passed += assert(live.reload(changes) && changes.empty() && live.snapshot() == second, true);
+
+             /*Older snapshots can go, the reused nodes stay alive*/
+             std::ofstream(filepath, std::ios_base::binary) << "server:\n  host: b\n  port: 8080\nlimits:\n  cpu: 2\n  mem: 4\n";
+             total++; passed += assert(live.reload(changes), true);
+             first.reset();
+             second.reset();
+             std::shared_ptr<Yaml> third = live.snapshot();
+             total++; passed += assert((*third)["limits"]["mem"].getValue(), std::string_view("4"));
+             total++; passed += assert((*third)["server"]["port"].getValue(), std::string_view("8080"));
+
+             std::ofstream(filepath, std::ios_base::binary) << "server: 1\n  - broken\n";
+             total++; passed += assert(live.reload(changes), false);
+             total++; passed += assert(live.getError().empty() || live.snapshot() != third, false);
+             std::remove(filepath.c_str());
+
+             /*Finding the arena of a reused node: every block is found by address, and nothing outside of them*/
+             Arena arena;
+             std::vector<char*> blocks;
+             for (int i = 0; i < 40; i++)
+                 blocks.push_back(static_cast<char*>(arena.allocate(256 * 1024, 8)));
+             bool found = true;
+             for (char* block : blocks)
+                 found = found && arena.contains(block) && arena.contains(block + 256 * 1024 - 1);
+             total++; passed += assert(found, true);
+             int outside = 0;
+             total++; passed += assert(arena.contains(&outside) || arena.contains(nullptr), false);
+             arena.rewind();
+             total++; passed += assert(arena.contains(blocks.back()) && !arena.contains(blocks.front()), true);
+         }catch(const std::exception& e){
+             std::cerr << e.what() << std::endl;
+             return false;
+         }
+         std::cout << "-- TESTGROUP test_reload RESULT: " << passed << " passed out of " << total << std::endl;
+         std::cout << "############################" << std::endl;
+         return true;
+     }
+ }}
@@ -0,0 +1,98 @@
+/**
+ * @file 20.hpp
+ * @author Mohammed Ghaith Al-Mahdawi (Mohido)
+ * @brief Tests the binary image of a tree
+ */
+
+ #include <iostream>
+ #include <fstream>
+ #include <iterator>
+ #include <cstdio>
+ #include "../yaml/yaml.hpp"
+ 
+ namespace TINY_YAML{
+ namespace tests {
+ 
+     #ifndef TINY_YAML_TESTS_HELPER_FUNCS
+     #define TINY_YAML_TESTS_HELPER_FUNCS
+         template<typename T>
+         bool assert(T v1, T v2){
+             bool result = v1 == v2;
+             std::cout << "TEST: Value (" << v1 << ") Expected to be (" << v2 << ")? " << ((result)? "passed" : "failed") << std::endl;
+             return result;
+         }
+ 
+         /// @brief - Mainly used in compile time to get the absolute path of .hpp/.cpp file parent directory
+         /// @return - Directory absolutepath of the current file.
+         std::string dirpath(){
+             std::string hppfilepath(__FILE__);
+             #if _WIN32
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("\\"));
+             #else 
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("/"));
+             #endif
+         }
+     #endif
+ 
+     bool test_20_binary_image(){
+         int passed = 0;
+         int total = 0;
+         std::cout << "############# TESTGROUP: test_binary_image" << std::endl;
+         try{
+             std::string image = dirpath() + std::string("/20_generated.tyb");
+             LoadOptions options;
+             options.resolveScalars = true;
+             Yaml source(dirpath() + std::string("/5.yaml"), options);
+             total++; passed += assert(source.saveBinary(image), true);
+
+             Yaml binary;
+             total++; passed += assert(binary.loadBinary(image), true);
+             total++; passed += assert(binary["node_list"].getKind() == Node::Kind::Sequence, true);
+             total++; passed += assert(binary["node_list"][1]["extra"][2].getValue(), std::string_view("extra3"));
+             total++; passed += assert(binary["node_list"][0]["value"].getScalar().type() == Value::Type::Int, true);
+             total++; passed += assert(binary["node_list"][0]["name"].as<std::string_view>(), std::string_view("node1"));
+             total++; passed += assert(binary.compile("node_list.0.hell.1.item1").get()->getValue(), std::string_view("\"mang\""));
+
+             /*Escaped strings keep their unescaped content, repeated keys and empty collections come back*/
+             Yaml escaped;
+             total++; passed += assert(escaped.parse("a:\n  k: \"tab\\there\"\n  e: []\nb:\n  k: 'x'\n", options) && escaped.saveBinary(image), true);
+             Yaml escapedBinary;
+             total++; passed += assert(escapedBinary.loadBinary(image), true);
+             total++; passed += assert(escapedBinary["a"]["k"].as<std::string_view>(), std::string_view("tab\there"));
+             total++; passed += assert(escapedBinary["a"]["k"].getValue(), std::string_view("\"tab\\there\""));
+             total++; passed += assert(escapedBinary["b"]["k"].as<std::string_view>(), std::string_view("x"));
+             total++; passed += assert(escapedBinary["a"]["e"].getKind() == Node::Kind::Sequence && escapedBinary["a"]["e"].getSize() == 0, true);
+
+             /*Broken images are refused*/
+             std::string saved;
+             {
+                 std::ifstream file(image, std::ios_base::binary);
+                 saved.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+             }
+             std::ofstream(image, std::ios_base::binary | std::ios_base::trunc) << saved.substr(0, saved.size() - 1);
+             total++; passed += assert(binary.loadBinary(image), false);
+             std::ofstream(image, std::ios_base::binary) << "TYAMLBIN garbage";
+             total++; passed += assert(binary.loadBinary(image), false);
+             total++; passed += assert(binary.getError().find("not a binary yaml image") != std::string::npos, true);
+             std::remove(image.c_str());
+
+             /*The sidecar cache is written by the first load and used by the next ones*/
+             std::string yaml = dirpath() + std::string("/20_generated.yaml");
+             std::ofstream(yaml, std::ios_base::binary) << "a: 1\nb:\n  - x\n";
+             Yaml first;
+             total++; passed += assert(first.loadCached(yaml, options) && std::ifstream(yaml + ".tyc").good(), true);
+             Yaml second;
+             total++; passed += assert(second.loadCached(yaml, options) && second["a"].as<int>() == 1 && second["b"][0].getValue() == "x", true);
+             Yaml unresolved;
+             total++; passed += assert(unresolved.loadCached(yaml) && unresolved["a"].getScalar().type() == Value::Type::Raw, true);
+             std::remove(yaml.c_str());
+             std::remove((yaml + ".tyc").c_str());
+         }catch(const std::exception& e){
+             std::cerr << e.what() << std::endl;
+             return false;
+         }
+         std::cout << "-- TESTGROUP test_binary_image RESULT: " << passed << " passed out of " << total << std::endl;
+         std::cout << "############################" << std::endl;
+         return true;
+     }
+ }}
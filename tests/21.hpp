@@ -0,0 +1,157 @@
+/**
+ * @file 21.hpp
+ * @author Mohammed Ghaith Al-Mahdawi (Mohido)
+ * @brief Tests writing documents back to yaml
+ */
+
+ #include <iostream>
+ #include <sstream>
+ #include <cstdio>
+ #include "../yaml/yaml.hpp"
+ 
+ namespace TINY_YAML{
+ namespace tests {
+ 
+     #ifndef TINY_YAML_TESTS_HELPER_FUNCS
+     #define TINY_YAML_TESTS_HELPER_FUNCS
+         template<typename T>
+         bool assert(T v1, T v2){
+             bool result = v1 == v2;
+             std::cout << "TEST: Value (" << v1 << ") Expected to be (" << v2 << ")? " << ((result)? "passed" : "failed") << std::endl;
+             return result;
+         }
+ 
+         /// @brief - Mainly used in compile time to get the absolute path of .hpp/.cpp file parent directory
+         /// @return - Directory absolutepath of the current file.
+         std::string dirpath(){
+             std::string hppfilepath(__FILE__);
+             #if _WIN32
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("\\"));
+             #else 
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("/"));
+             #endif
+         }
+     #endif
+ 
+     /// @brief - Scalars written differently (e.g. quoted once saved) are the same if they resolve to the same value.
+     bool sameScalar(std::string_view first, std::string_view second, Arena& arena){
+         Value a = Value::resolve(first, arena);
+         Value b = Value::resolve(second, arena);
+         if (a.type() != b.type())
+             return false;
+         return (a.type() == Value::Type::String) ? a.as<std::string_view>() == b.as<std::string_view>() : first == second;
+     }
+
+     /// @brief - Same kinds, keys and values in the same order. Keys are stored unquoted, so they must be equal as they are.
+     bool sameTree(const Node& first, const Node& second, Arena& arena){
+         if (first.getKind() != second.getKind() || first.getSize() != second.getSize())
+             return false;
+         if (first.getKind() == Node::Kind::Scalar)
+             return sameScalar(first.getValue(), second.getValue(), arena);
+         auto a = first.getChildren().begin();
+         auto b = second.getChildren().begin();
+         for (; a != first.getChildren().end(); ++a, ++b)
+             if ((first.getKind() == Node::Kind::Mapping && a->key != b->key) || !sameTree(*a->node, *b->node, arena))
+                 return false;
+         return true;
+     }
+
+     bool test_21_save(){
+         int passed = 0;
+         int total = 0;
+         std::cout << "############# TESTGROUP: test_save" << std::endl;
+         try{
+             Yaml source(dirpath() + std::string("/5.yaml"));
+             std::ostringstream first;
+             total++; passed += assert(source.save(first), true);
+             const std::string text = first.str();
+             total++; passed += assert(text.substr(0, 42), std::string("node_list:\n  - name: \"node1\"\n    value: 1\n"));
+
+             /*The saved document loads back into the same tree, and saves the same again*/
+             Yaml reloaded;
+             total++; passed += assert(reloaded.parse(text), true);
+             total++; passed += assert(reloaded["node_list"][0]["hell"][1]["item1"].getValue(), std::string_view("\"mang\""));
+             total++; passed += assert(reloaded["node_list"][1]["extra"][2].getValue(), std::string_view("extra3"));
+             std::ostringstream second;
+             reloaded.save(second);
+             total++; passed += assert(second.str(), text);
+
+             /*One writer (with a tiny buffer) for many documents, and files*/
+             std::ostringstream many;
+             {
+                 Writer writer(many, 16);
+                 for (int i = 1; i <= 5; i++) {
+                     Yaml document(dirpath() + "/" + std::to_string(i) + ".yaml");
+                     document.save(writer);
+                 }
+             }
+             const std::string concatenated = many.str();
+             Yaml all;
+             total++; passed += assert(all.parse(concatenated), true);
+             total++; passed += assert(all["age"].getValue(), std::string_view("123"));
+
+             std::string filepath = dirpath() + std::string("/21_generated.yaml");
+             total++; passed += assert(source.save(filepath), true);
+             Yaml saved(filepath);
+             total++; passed += assert(saved["node_list"][1]["temp"].getValue(), std::string_view("extra"));
+             std::remove(filepath.c_str());
+
+             /*Trees of JSON documents and flow collections load back the same: textmarks are quoted, nested sequences and empty collections written in flow style*/
+             Yaml fromJson;
+             total++; passed += assert(fromJson.parseJson("{\"r\":{\"a: b\":1,\"# c\":2,\"- d\":3,\"[e\":\"f\",\"{g\":\"h, i\",\"it's\":\"x\",\" pad \":null,"
+                 "\"e\":[],\"o\":{},\"m\":[[1,2],[3],[],[{}],{\"k\":[]},\"-\",\"\"],\"q\":\"a\\\"b\",\"s\":\"multi\\nline\"}}"), true);
+             Yaml fromFlow;
+             total++; passed += assert(fromFlow.parse("r:\n  m: [[1, 2], [3]]\n  k: [{}, {a: 1}]\n  x: {a: [], b: {}, c: [[]], d}\n  y: [[{d, e: \"1, 2\"}], ['x: y', plain text]]\n"), true);
+             for (Yaml* tree : { &fromJson, &fromFlow }) {
+                 std::ostringstream saved;
+                 tree->save(saved);
+                 const std::string document = saved.str();    // Parsed in place
+                 Yaml reloaded;
+                 total++; passed += assert(reloaded.parse(document), true);
+                 Arena arena;
+                 total++; passed += assert(sameTree(tree->at("r"), reloaded.at("r"), arena), true);
+                 if (tree == &fromJson) {
+                     total++; passed += assert(reloaded.at("r").find("a: b") != nullptr && reloaded.at("r").find("# c") != nullptr, true);
+                     total++; passed += assert(reloaded.at("r").find("- d") != nullptr && reloaded.at("r").find(" pad ") != nullptr, true);
+                 }
+                 std::ostringstream again;
+                 reloaded.save(again);
+                 total++; passed += assert(again.str(), document);
+             }
+             /*Quoted keys of yaml documents are found without their quotes, as the keys of JSON documents*/
+             Yaml yamlKeys;
+             total++; passed += assert(yamlKeys.parse("\"a: b\": 1\n'# c':\n  \"tab\\tkey\": 2\nflow: {\"x, y\": 3}\n"), true);
+             total++; passed += assert(yamlKeys.at("a: b").getValue(), std::string_view("1"));
+             total++; passed += assert(yamlKeys.at("# c").at("tab\tkey").getValue(), std::string_view("2"));
+             total++; passed += assert(yamlKeys.at("flow").at("x, y").getValue(), std::string_view("3"));
+             total++; passed += assert(yamlKeys.find("\"a: b\"") == nullptr, true);
+             Yaml duplicatedKeys;
+             total++; passed += assert(duplicatedKeys.parse("k:\n  a: 1\n  \"a\": 2\n"), false);
+
+             /*Keys with textmarks are quoted when saved and found unquoted once loaded back, in mappings, items and flow collections*/
+             Yaml marked;
+             total++; passed += assert(marked.parse("\"a: b\":\n  '# c': 1\n  \"- d\": 2\nlist:\n  - \"- e\": 3\n    \"f #g\": 4\n  - [{\"h: i\": []}]\n"), true);
+             std::ostringstream markedSaved;
+             marked.save(markedSaved);
+             const std::string markedText = markedSaved.str();
+             total++; passed += assert(markedText, std::string("\"a: b\":\n  \"# c\": 1\n  \"- d\": 2\nlist:\n  - \"- e\": 3\n    \"f #g\": 4\n  - [{\"h: i\": []}]\n"));
+             Yaml markedReloaded;
+             total++; passed += assert(markedReloaded.parse(markedText), true);
+             total++; passed += assert(markedReloaded.find("a: b") != nullptr && markedReloaded.at("a: b").find("# c") != nullptr, true);
+             total++; passed += assert(markedReloaded.at("a: b").at("- d").getValue(), std::string_view("2"));
+             total++; passed += assert(markedReloaded.at("list").at("0").at("- e").getValue(), std::string_view("3"));
+             total++; passed += assert(markedReloaded.at("list").at("0").at("f #g").getValue(), std::string_view("4"));
+             total++; passed += assert(markedReloaded.at("list").at("1").at("0").find("h: i") != nullptr, true);
+
+             std::ostringstream flowSaved;
+             fromFlow.save(flowSaved);
+             total++; passed += assert(flowSaved.str().substr(0, 56), std::string("r:\n  m:\n    - [1, 2]\n    - [3]\n  k:\n    - {}\n    - a: 1\n"));
+         }catch(const std::exception& e){
+             std::cerr << e.what() << std::endl;
+             return false;
+         }
+         std::cout << "-- TESTGROUP test_save RESULT: " << passed << " passed out of " << total << std::endl;
+         std::cout << "############################" << std::endl;
+         return true;
+     }
+ }}
@@ -0,0 +1,106 @@
+/**
+ * @file 22.hpp
+ * @author Mohammed Ghaith Al-Mahdawi (Mohido)
+ * @brief Tests transcoding yaml to JSON and parsing JSON
+ */
+
+ #include <iostream>
+ #include <sstream>
+ #include "../yaml/yaml.hpp"
+ 
+ namespace TINY_YAML{
+ namespace tests {
+ 
+     #ifndef TINY_YAML_TESTS_HELPER_FUNCS
+     #define TINY_YAML_TESTS_HELPER_FUNCS
+         template<typename T>
+         bool assert(T v1, T v2){
+             bool result = v1 == v2;
+             std::cout << "TEST: Value (" << v1 << ") Expected to be (" << v2 << ")? " << ((result)? "passed" : "failed") << std::endl;
+             return result;
+         }
+ 
+         /// @brief - Mainly used in compile time to get the absolute path of .hpp/.cpp file parent directory
+         /// @return - Directory absolutepath of the current file.
+         std::string dirpath(){
+             std::string hppfilepath(__FILE__);
+             #if _WIN32
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("\\"));
+             #else 
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("/"));
+             #endif
+         }
+     #endif
+ 
+     bool test_22_json(){
+         int passed = 0;
+         int total = 0;
+         std::cout << "############# TESTGROUP: test_json" << std::endl;
+         try{
+             /*Yaml to JSON, scalars are typed*/
+             std::istringstream yaml("name: \"tab\\there\"\nage: 0x10\nratio: 1.50\nok: yes\nnone: ~\nlist:\n  - a\n  - b: 1\n    c: .inf\nempty:\n");
+             std::ostringstream json;
+             std::string error;
+             total++; passed += assert(JsonWriter::transcode(yaml, json, error), true);
+             total++; passed += assert(json.str(), std::string("{\"name\":\"tab\\there\",\"age\":16,\"ratio\":1.5,\"ok\":\"yes\",\"none\":null,\"list\":[\"a\",{\"b\":1,\"c\":\".inf\"}],\"empty\":null}"));
+
+             /*Flow collections are collections in JSON too*/
+             std::istringstream flow("ports: [80, 443]\nm: {a: [1, {b: c}], \"q: k\": x, e: []}\nitems:\n  - [1, 2]\n  - {k: v}\n");
+             std::ostringstream flowJson;
+             total++; passed += assert(JsonWriter::transcode(flow, flowJson, error), true);
+             total++; passed += assert(flowJson.str(), std::string("{\"ports\":[80,443],\"m\":{\"a\":[1,{\"b\":\"c\"}],\"q: k\":\"x\",\"e\":[]},\"items\":[[1,2],{\"k\":\"v\"}]}"));
+             std::ostringstream ignored;
+             std::istringstream badFlow("a: [1, 2\n");
+             total++; passed += assert(JsonWriter::transcode(badFlow, ignored, error), false);
+
+             /*Nothing is read once the JSON can not be written*/
+             std::string many;
+             while (many.size() < 4 * TINY_YAML_READ_BLOCK_SIZE)
+                 many += "key" + std::to_string(many.size()) + ": value\n";
+             std::istringstream unwritten(many);
+             std::ostringstream failed;
+             failed.setstate(std::ios_base::badbit);
+             total++; passed += assert(JsonWriter::transcode(unwritten, failed, error), false);
+             total++; passed += assert(static_cast<std::size_t>(unwritten.tellg()), std::size_t(0));
+
+             std::istringstream invalid("a: 1\n  - b\n");
+             total++; passed += assert(JsonWriter::transcode(invalid, ignored, error), false);
+             total++; passed += assert(error.empty(), false);
+
+             /*JSON into the tree*/
+             const std::string text = "{ \"name\": \"caf\\u00e9 \\ud83d\\ude00\", \"size\": -12.5e1, \"tags\": [\"x\", true, null],\n"
+                                      "  \"nested\": {\"a\\\"b\": {}, \"list\": []} }";
+             Yaml parsed;
+             total++; passed += assert(parsed.parseJson(text, LoadOptions{true}), true);
+             total++; passed += assert(parsed["name"].as<std::string_view>(), std::string_view("caf\xc3\xa9 \xf0\x9f\x98\x80"));
+             total++; passed += assert(parsed["size"].as<double>(), -125.0);
+             total++; passed += assert(parsed["tags"].getSize(), 3u);
+             total++; passed += assert(parsed["tags"][1].as<bool>(), true);
+             total++; passed += assert(parsed["tags"][2].getScalar().isNull(), true);
+             total++; passed += assert(parsed["nested"]["a\"b"].getKind() == Node::Kind::Mapping, true);
+             total++; passed += assert(parsed["nested"]["list"].getKind() == Node::Kind::Sequence, true);
+
+             /*The tree of a JSON document is saved back as yaml*/
+             Yaml raw;
+             total++; passed += assert(raw.parseJson("{\"a\": {\"b\": \"text\", \"c\": [1, 2]}}"), true);
+             std::ostringstream saved;
+             raw.save(saved);
+             total++; passed += assert(saved.str(), std::string("a:\n  b: \"text\"\n  c:\n    - 1\n    - 2\n"));
+
+             /*Invalid documents*/
+             Yaml bad;
+             total++; passed += assert(bad.parseJson("[1, 2]"), false);
+             total++; passed += assert(bad.parseJson("{\"a\": 1,\n \"a\": 2}"), false);
+             total++; passed += assert(bad.parseJson("{\"a\": 1}\n{"), false);
+             total++; passed += assert(bad.getError(), std::string("invalid json syntax at line: 2"));
+             total++; passed += assert(bad.parseJson("{\"a\": tru}"), false);
+             total++; passed += assert(bad.parseJson("{\"deep\": " + std::string(2000, '[')), false);
+         }catch(const std::exception& e){
+             std::cerr << e.what() << std::endl;
+             return false;
+         }
+         std::cout << "-- TESTGROUP test_json RESULT: " << passed << " passed out of " << total << std::endl;
+         std::cout << "############################" << std::endl;
+         return true;
+     }
+ }}
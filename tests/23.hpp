@@ -0,0 +1,87 @@
+/**
+ * @file 23.hpp
+ * @author Mohammed Ghaith Al-Mahdawi (Mohido)
+ * @brief Tests the load statistics (counters with TINY_YAML_STATS=1, all zero otherwise)
+ */
+
+ #include <iostream>
+ #include <sstream>
+ #include "../yaml/yaml.hpp"
+ 
+ namespace TINY_YAML{
+ namespace tests {
+ 
+     #ifndef TINY_YAML_TESTS_HELPER_FUNCS
+     #define TINY_YAML_TESTS_HELPER_FUNCS
+         template<typename T>
+         bool assert(T v1, T v2){
+             bool result = v1 == v2;
+             std::cout << "TEST: Value (" << v1 << ") Expected to be (" << v2 << ")? " << ((result)? "passed" : "failed") << std::endl;
+             return result;
+         }
+ 
+         /// @brief - Mainly used in compile time to get the absolute path of .hpp/.cpp file parent directory
+         /// @return - Directory absolutepath of the current file.
+         std::string dirpath(){
+             std::string hppfilepath(__FILE__);
+             #if _WIN32
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("\\"));
+             #else 
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("/"));
+             #endif
+         }
+     #endif
+ 
+     bool test_23_stats(){
+         int passed = 0;
+         int total = 0;
+         std::cout << "############# TESTGROUP: test_stats" << std::endl;
+         try{
+             Yaml yaml(dirpath() + std::string("/5.yaml"));
+             LoadStats stats = yaml.getStats();
+         #if TINY_YAML_STATS
+             /*tests/5.yaml: 13 lines, 17 nodes, node_list > item > hell > item is the deepest parent*/
+             total++; passed += assert(stats.bytesRead, std::uint64_t(210));
+             total++; passed += assert(stats.lines, std::uint64_t(13));
+             total++; passed += assert(stats.nodes, std::uint64_t(17));
+             total++; passed += assert(stats.maxDepth, std::uint32_t(4));
+             total++; passed += assert(stats.allocations > stats.nodes, true);
+             total++; passed += assert(stats.bytesReserved >= stats.bytesAllocated, true);
+             total++; passed += assert(stats.totalSeconds >= stats.readSeconds + stats.scanSeconds + stats.buildSeconds, true);
+             total++; passed += assert(stats.events.size(), std::size_t(1));
+
+             /*Workers and lazy parses add their own events*/
+             std::string text;
+             for (int i = 0; i < 100000; i++)
+                 text += "key" + std::to_string(i) + ":\n  value: " + std::to_string(i) + "\n";
+             Yaml parallel;
+             parallel.parse(text, LoadOptions{false, 4});
+             stats = parallel.getStats();
+             total++; passed += assert(stats.lines, std::uint64_t(200000));
+             total++; passed += assert(stats.nodes >= 200000, true);                 // Plus the roots of the extra workers
+             total++; passed += assert(stats.events.size() > 1, true);
+
+             LoadOptions lazy;
+             lazy.lazy = true;
+             Yaml deferred;
+             deferred.parse(text, lazy);
+             std::uint64_t before = deferred.getStats().nodes;
+             deferred["key7"]["value"];
+             total++; passed += assert(deferred.getStats().nodes, before + 1);
+
+             std::ostringstream trace;
+             stats.writeTrace(trace);
+             total++; passed += assert(trace.str().find("\"name\":\"chunk\"") != std::string::npos, true);
+         #else
+             total++; passed += assert(stats.nodes, std::uint64_t(0));
+             total++; passed += assert(stats.events.empty(), true);
+         #endif
+         }catch(const std::exception& e){
+             std::cerr << e.what() << std::endl;
+             return false;
+         }
+         std::cout << "-- TESTGROUP test_stats RESULT: " << passed << " passed out of " << total << std::endl;
+         std::cout << "############################" << std::endl;
+         return true;
+     }
+ }}
@@ -0,0 +1,136 @@
+/**
+ * @file 24.hpp
+ * @author Mohammed Ghaith Al-Mahdawi (Mohido)
+ * @brief Tests binding documents to C++ structs
+ */
+
+ #include <iostream>
+ #include <sstream>
+ #include "../yaml/yaml.hpp"
+
+ namespace TINY_YAML{
+ namespace tests {
+
+     struct BoundItem {
+         std::string item1;
+     };
+     TINY_YAML_BIND(BoundItem, TINY_YAML_FIELD(item1))
+
+     struct BoundNode {
+         std::string name;
+         int value = 0;
+         std::optional<std::string> temp;
+         std::vector<BoundItem> hell;
+         std::vector<std::string> extra;
+     };
+     TINY_YAML_BIND(BoundNode, TINY_YAML_FIELD(name), TINY_YAML_FIELD(value), TINY_YAML_FIELD(temp), TINY_YAML_FIELD(hell), TINY_YAML_FIELD(extra))
+
+     struct BoundDocument {
+         std::vector<BoundNode> nodes;
+     };
+     TINY_YAML_BIND(BoundDocument, TINY_YAML_FIELD_NAMED("node_list", nodes))
+
+     struct BoundServer {
+         std::string host;
+         std::uint16_t port = 0;
+         double ratio = 0;
+         bool enabled = false;
+         std::optional<int> retries;
+     };
+     TINY_YAML_BIND(BoundServer, TINY_YAML_FIELD(host), TINY_YAML_FIELD(port), TINY_YAML_FIELD(ratio), TINY_YAML_FIELD(enabled), TINY_YAML_FIELD(retries))
+
+     struct BoundConfig {
+         BoundServer server;
+     };
+     TINY_YAML_BIND(BoundConfig, TINY_YAML_FIELD(server))
+
+     struct BoundPorts {
+         std::vector<int> ports;
+     };
+     TINY_YAML_BIND(BoundPorts, TINY_YAML_FIELD(ports))
+
+     #ifndef TINY_YAML_TESTS_HELPER_FUNCS
+     #define TINY_YAML_TESTS_HELPER_FUNCS
+         template<typename T>
+         bool assert(T v1, T v2){
+             bool result = v1 == v2;
+             std::cout << "TEST: Value (" << v1 << ") Expected to be (" << v2 << ")? " << ((result)? "passed" : "failed") << std::endl;
+             return result;
+         }
+ 
+         /// @brief - Mainly used in compile time to get the absolute path of .hpp/.cpp file parent directory
+         /// @return - Directory absolutepath of the current file.
+         std::string dirpath(){
+             std::string hppfilepath(__FILE__);
+             #if _WIN32
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("\\"));
+             #else 
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("/"));
+             #endif
+         }
+     #endif
+
+     bool test_24_binding(){
+         int passed = 0;
+         int total = 0;
+         std::cout << "############# TESTGROUP: test_binding" << std::endl;
+         try{
+             /*tests/5.yaml straight into structs*/
+             BoundDocument document;
+             std::string error;
+             total++; passed += assert(bindFile(dirpath() + std::string("/5.yaml"), document, error), true);
+             total++; passed += assert(document.nodes.size(), std::size_t(2));
+             total++; passed += assert(document.nodes[0].name, std::string("node1"));
+             total++; passed += assert(document.nodes[1].value, 2);
+             total++; passed += assert(document.nodes[0].hell[1].item1, std::string("mang"));
+             total++; passed += assert(document.nodes[0].temp.has_value(), false);
+             total++; passed += assert(*document.nodes[1].temp, std::string("extra"));
+             total++; passed += assert(document.nodes[1].extra[2], std::string("extra3"));
+
+             /*Typed scalars, optionals and skipped keys*/
+             BoundConfig config;
+             total++; passed += assert(bind(std::string_view("server:\n  host: \"db\\tlocal\"\n  port: 0x1F90\n  ratio: 2.5\n  enabled: true\n  retries: ~\n  unknown:\n    - skipped\n"), config, error), true);
+             total++; passed += assert(config.server.host, std::string("db\tlocal"));
+             total++; passed += assert(config.server.port, std::uint16_t(8080));
+             total++; passed += assert(config.server.ratio, 2.5);
+             total++; passed += assert(config.server.enabled, true);
+             total++; passed += assert(config.server.retries.has_value(), false);
+
+             /*Flow collections bind like their block form*/
+             BoundPorts ports;
+             total++; passed += assert(bind(std::string_view("ports: [80, 443]\n"), ports, error), true);
+             total++; passed += assert(ports.ports.size(), std::size_t(2));
+             total++; passed += assert(ports.ports[1], 443);
+             BoundDocument flow;
+             total++; passed += assert(bind(std::string_view("node_list: [{name: n, value: 3, hell: [{item1: x}], extra: [a, 'b, c']}]\n"), flow, error), true);
+             total++; passed += assert(flow.nodes[0].hell[0].item1, std::string("x"));
+             total++; passed += assert(flow.nodes[0].extra[1], std::string("b, c"));
+
+             /*Errors name the field*/
+             total++; passed += assert(bind(std::string_view("server:\n  host: a\n  port: 70000\n  ratio: 1\n  enabled: false\n"), config, error), false);
+             total++; passed += assert(error, std::string("server.port: expected an integer, got \"70000\" at line 3"));
+             total++; passed += assert(bind(std::string_view("server:\n  host: a\n  ratio: 1\n  enabled: false\n"), config, error), false);
+             total++; passed += assert(error.find("server: missing field 'port'") == 0, true);
+             total++; passed += assert(bind(std::string_view("server: text\n"), config, error), false);
+             total++; passed += assert(error, std::string("server: expected a mapping, got \"text\" at line 1"));
+             std::istringstream invalid("server:\n  host: 1\n    - x\n");
+             total++; passed += assert(bind(invalid, config, error), false);
+             total++; passed += assert(error.empty(), false);
+
+             /*A type error on the first line stops reading the stream after its first block*/
+             std::string filler;
+             while (filler.size() < 4 * TINY_YAML_READ_BLOCK_SIZE)
+                 filler += "skipped: line\n";
+             std::istringstream early("server: text\n" + filler);
+             total++; passed += assert(bind(early, config, error), false);
+             total++; passed += assert(error, std::string("server: expected a mapping, got \"text\" at line 1"));
+             total++; passed += assert(static_cast<std::size_t>(early.tellg()), std::size_t(TINY_YAML_READ_BLOCK_SIZE));
+         }catch(const std::exception& e){
+             std::cerr << e.what() << std::endl;
+             return false;
+         }
+         std::cout << "-- TESTGROUP test_binding RESULT: " << passed << " passed out of " << total << std::endl;
+         std::cout << "############################" << std::endl;
+         return true;
+     }
+ }}
@@ -0,0 +1,128 @@
+/**
+ * @file 25.hpp
+ * @author Mohammed Ghaith Al-Mahdawi (Mohido)
+ * @brief Tests the const lookup API and many threads reading one document
+ */
+
+ #include <iostream>
+ #include <thread>
+ #include <atomic>
+ #include <vector>
+ #include "../yaml/yaml.hpp"
+ 
+ namespace TINY_YAML{
+ namespace tests {
+ 
+     #ifndef TINY_YAML_TESTS_HELPER_FUNCS
+     #define TINY_YAML_TESTS_HELPER_FUNCS
+         template<typename T>
+         bool assert(T v1, T v2){
+             bool result = v1 == v2;
+             std::cout << "TEST: Value (" << v1 << ") Expected to be (" << v2 << ")? " << ((result)? "passed" : "failed") << std::endl;
+             return result;
+         }
+ 
+         /// @brief - Mainly used in compile time to get the absolute path of .hpp/.cpp file parent directory
+         /// @return - Directory absolutepath of the current file.
+         std::string dirpath(){
+             std::string hppfilepath(__FILE__);
+             #if _WIN32
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("\\"));
+             #else 
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("/"));
+             #endif
+         }
+     #endif
+
+     /// @brief - Every thread looks up every key of the shared document, returns the number of wrong answers.
+     int readConcurrently(const Yaml& yaml, int keys, int threads){
+         std::atomic<int> wrong(0);
+         std::vector<std::thread> readers;
+         for (int t = 0; t < threads; t++) {
+             readers.emplace_back([&, t]() {
+                 for (int k = 0; k < keys; k++) {
+                     int key = (k * 7 + t * 13) % keys;
+                     std::string name = "key" + std::to_string(key);
+                     const Node* node = yaml.find(name);
+                     if (node == nullptr || node->getIf<int>("value") != key || node->at("items").at(1).as<int>() != key + 1)
+                         wrong++;
+                     if (yaml.find(name + "_missing") != nullptr || node->getIf<int>("missing").has_value())
+                         wrong++;
+                 }
+             });
+         }
+         for (std::thread& reader : readers)
+             reader.join();
+         return wrong.load();
+     }
+ 
+     bool test_25_concurrent_reads(){
+         int passed = 0;
+         int total = 0;
+         std::cout << "############# TESTGROUP: test_concurrent_reads" << std::endl;
+         try{
+             /*Const lookups never modify the document*/
+             const Yaml yaml(dirpath() + std::string("/5.yaml"));
+             total++; passed += assert(yaml.find("missing") == nullptr, true);
+             total++; passed += assert(yaml.at("node_list").find("2") == nullptr, true);
+             total++; passed += assert(yaml["node_list"][1]["extra"][2].getValue(), std::string_view("extra3"));
+             total++; passed += assert(yaml["node_list"][0].getIf<int>("value").value_or(-1), 1);
+             total++; passed += assert(yaml["node_list"][0].getIf<int>("name").has_value(), false);
+             total++; passed += assert(yaml.getIf<int>("node_list").has_value(), false);
+
+             /*Out of range values and broken lazy blocks give no value either*/
+             Yaml ranged;
+             ranged.parse("small: 300\nbig: 99999999999\n");
+             total++; passed += assert(ranged.getIf<std::uint8_t>("small").has_value(), false);
+             total++; passed += assert(ranged.getIf<int>("big").has_value(), false);
+             total++; passed += assert(ranged.getIf<std::int64_t>("big").value_or(0), std::int64_t(99999999999));
+             LoadOptions lazyBroken;
+             lazyBroken.lazy = true;
+             Yaml broken;
+             broken.parse("ok: 1\nbroken:\n  a: 1\n  - b\n", lazyBroken);
+             total++; passed += assert(broken.getIf<int>("ok").value_or(-1), 1);
+             total++; passed += assert(broken["broken"].getIf<int>("a").has_value(), false);
+             bool thrown = false;
+             try { yaml.at("missing"); } catch (const std::out_of_range&) { thrown = true; }
+             total++; passed += assert(thrown, true);
+
+             /*Many readers, on a fully parsed document and on a lazy one expanding under them*/
+             std::string text;
+             const int keys = 2000;
+             for (int k = 0; k < keys; k++)
+                 text += "key" + std::to_string(k) + ":\n  value: " + std::to_string(k) + "\n  items:\n    - " + std::to_string(k) + "\n    - " + std::to_string(k + 1) + "\n";
+             Yaml eager;
+             eager.parse(text, LoadOptions{true});
+             total++; passed += assert(readConcurrently(eager, keys, 8), 0);
+             LoadOptions lazy;
+             lazy.lazy = true;
+             Yaml deferred;
+             deferred.parse(text, lazy);
+             total++; passed += assert(readConcurrently(deferred, keys, 8), 0);
+
+             /*One compiled path shared by the readers, its cache refreshed by all of them after a new load*/
+             Path shared = deferred.compile("key1999.items.1");
+             for (int round = 0; round < 2; round++) {
+                 if (round == 1)
+                     deferred.parse(text, lazy);
+                 std::atomic<int> wrong{ 0 };
+                 std::vector<std::thread> readers;
+                 for (int t = 0; t < 8; t++)
+                     readers.emplace_back([&]() {
+                         for (int i = 0; i < 1000; i++)
+                             if (shared.get() == nullptr || shared->getValue() != "2000")
+                                 wrong++;
+                     });
+                 for (std::thread& reader : readers)
+                     reader.join();
+                 total++; passed += assert(wrong.load(), 0);
+             }
+         }catch(const std::exception& e){
+             std::cerr << e.what() << std::endl;
+             return false;
+         }
+         std::cout << "-- TESTGROUP test_concurrent_reads RESULT: " << passed << " passed out of " << total << std::endl;
+         std::cout << "############################" << std::endl;
+         return true;
+     }
+ }}
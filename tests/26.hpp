@@ -0,0 +1,83 @@
+/**
+ * @file 26.hpp
+ * @author Mohammed Ghaith Al-Mahdawi (Mohido)
+ * @brief Tests the interning of repeated keys
+ */
+
+ #include <iostream>
+ #include <sstream>
+ #include "../yaml/yaml.hpp"
+ 
+ namespace TINY_YAML{
+ namespace tests {
+ 
+     #ifndef TINY_YAML_TESTS_HELPER_FUNCS
+     #define TINY_YAML_TESTS_HELPER_FUNCS
+         template<typename T>
+         bool assert(T v1, T v2){
+             bool result = v1 == v2;
+             std::cout << "TEST: Value (" << v1 << ") Expected to be (" << v2 << ")? " << ((result)? "passed" : "failed") << std::endl;
+             return result;
+         }
+ 
+         /// @brief - Mainly used in compile time to get the absolute path of .hpp/.cpp file parent directory
+         /// @return - Directory absolutepath of the current file.
+         std::string dirpath(){
+             std::string hppfilepath(__FILE__);
+             #if _WIN32
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("\\"));
+             #else 
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("/"));
+             #endif
+         }
+     #endif
+ 
+     bool test_26_key_pool(){
+         int passed = 0;
+         int total = 0;
+         std::cout << "############# TESTGROUP: test_key_pool" << std::endl;
+         try{
+             /*A stream load keeps one copy per distinct key*/
+             Yaml yaml(dirpath() + std::string("/5.yaml"));
+             const char* first = yaml["node_list"][0]["name"].getID().data();
+             total++; passed += assert(yaml["node_list"][1]["name"].getID().data() == first, true);
+             total++; passed += assert(yaml["node_list"][0]["hell"][1]["item1"].getID().data() == yaml["node_list"][0]["hell"][0]["item1"].getID().data(), true);
+             total++; passed += assert(yaml.key("name").data() == first, true);
+             total++; passed += assert(yaml["node_list"][1].find(yaml.key("temp"))->getValue(), std::string_view("extra"));
+
+             /*Keys that are not pooled are found as usual*/
+             std::string unknown = "extra";
+             total++; passed += assert(yaml.key("missing"), std::string_view("missing"));
+             total++; passed += assert(yaml["node_list"][1].find(yaml.key(unknown)) != nullptr, true);
+
+             /*In place loads point into the text, nothing is pooled*/
+             const std::string text = "a:\n  k: 1\nb:\n  k: 2\n";
+             Yaml inPlace;
+             inPlace.parse(text);
+             total++; passed += assert(inPlace["a"]["k"].getID().data() == inPlace["b"]["k"].getID().data(), false);
+
+             /*Past the size of the pool, the keys pooled before it filled up are still shared*/
+             std::string many = "first:\n  name: x\n";
+             for (int i = 0; i < TINY_YAML_KEY_POOL_SIZE + 5000; i++)
+                 many += "key" + std::to_string(i) + ": " + std::to_string(i) + "\n";
+             many += "more:\n  - name: a\n  - name: b\n";
+             std::istringstream manyStream(many);
+             Yaml full;
+             total++; passed += assert(full.load(manyStream), true);
+             const char* pooled = full.key("name").data();
+             total++; passed += assert(full["more"][0]["name"].getID().data() == pooled && full["more"][1]["name"].getID().data() == pooled, true);
+             total++; passed += assert(full["key70000"].getValue(), std::string_view("70000"));
+
+             /*Reloading forgets the keys of the previous document*/
+             std::istringstream stream("other: 1\n");
+             yaml.load(stream);
+             total++; passed += assert(yaml.key("name").data() == first, false);
+         }catch(const std::exception& e){
+             std::cerr << e.what() << std::endl;
+             return false;
+         }
+         std::cout << "-- TESTGROUP test_key_pool RESULT: " << passed << " passed out of " << total << std::endl;
+         std::cout << "############################" << std::endl;
+         return true;
+     }
+ }}
@@ -0,0 +1,141 @@
+/**
+ * @file 27.hpp
+ * @author Mohammed Ghaith Al-Mahdawi (Mohido)
+ * @brief Tests the structured errors of the loads
+ */
+
+ #include <iostream>
+ #include <sstream>
+ #include "../yaml/yaml.hpp"
+ 
+ namespace TINY_YAML{
+ namespace tests {
+ 
+     #ifndef TINY_YAML_TESTS_HELPER_FUNCS
+     #define TINY_YAML_TESTS_HELPER_FUNCS
+         template<typename T>
+         bool assert(T v1, T v2){
+             bool result = v1 == v2;
+             std::cout << "TEST: Value (" << v1 << ") Expected to be (" << v2 << ")? " << ((result)? "passed" : "failed") << std::endl;
+             return result;
+         }
+ 
+         /// @brief - Mainly used in compile time to get the absolute path of .hpp/.cpp file parent directory
+         /// @return - Directory absolutepath of the current file.
+         std::string dirpath(){
+             std::string hppfilepath(__FILE__);
+             #if _WIN32
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("\\"));
+             #else 
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("/"));
+             #endif
+         }
+     #endif
+ 
+     bool test_27_parse_errors(){
+         int passed = 0;
+         int total = 0;
+         std::cout << "############# TESTGROUP: test_parse_errors" << std::endl;
+         try{
+             using Code = ParseError::Code;
+             Yaml yaml;
+
+             /*A successful load has no error*/
+             ParseError error = yaml.tryLoad(dirpath() + std::string("/5.yaml"));
+             total++; passed += assert(error.ok(), true);
+             total++; passed += assert(yaml.getParseError().ok(), true);
+             total++; passed += assert(yaml["node_list"][0]["name"].getValue(), std::string_view("\"node1\""));
+
+             /*Missing file*/
+             error = yaml.tryLoad(dirpath() + std::string("/missing.yaml"));
+             total++; passed += assert(error.code == Code::CannotOpen, true);
+             total++; passed += assert(error.line, 0u);
+             total++; passed += assert(error.message, std::string_view("file cannot be opened"));
+
+             /*Exceptions other than a failed allocation have their own code*/
+             total++; passed += assert(ParseError::describe(Code::UnexpectedException), std::string_view("unexpected exception while loading"));
+
+             /*Line and column (1 based) of every kind of syntax error*/
+             struct Case {
+                 std::string text;
+                 Code code;
+                 unsigned int line;
+                 unsigned int column;
+             };
+             const Case cases[] = {
+                 { "a: 1\nb: \"open\n", Code::UnclosedQuote, 2, 4 },
+                 { "a: 1\n  plain\n", Code::MissingColon, 2, 3 },
+                 { "a:\n  b: 1\n  - item\n", Code::MisplacedDash, 3, 3 },
+                 { "a:\n  b: 1\n  b: 2\n", Code::DuplicateKey, 3, 3 },
+                 { "a:\n  x: 1\na:\n  y: 1\n", Code::DuplicateKey, 3, 1 },
+                 { "a:\n  - 1\n  b: 2\n", Code::MixedCollection, 3, 3 },
+             };
+             for (const Case& test : cases) {
+                 std::istringstream stream(test.text);
+                 total++; passed += assert(yaml.load(stream), false);
+                 const ParseError& failure = yaml.getParseError();
+                 total++; passed += assert(failure.code == test.code, true);
+                 total++; passed += assert(failure.line, test.line);
+                 total++; passed += assert(failure.column, test.column);
+                 total++; passed += assert(failure.message.empty(), false);
+
+                 /*Same error when the text is parsed in place, lazily or in parallel*/
+                 LoadOptions lazy;
+                 lazy.lazy = true;
+                 yaml.parse(test.text);
+                 total++; passed += assert(yaml.getParseError().code == test.code && yaml.getParseError().line == test.line, true);
+                 yaml.parse(test.text, lazy);
+                 bool thrown = false;
+                 try {
+                     if (yaml.getParseError().ok())
+                         yaml["a"].find("x");
+                 }
+                 catch (const ParseException& e) {
+                     thrown = e.error().code == test.code && e.error().line == test.line;
+                 }
+                 total++; passed += assert(thrown || (yaml.getParseError().code == test.code && yaml.getParseError().line == test.line), true);
+             }
+
+             /*A parallel load reports the line in the whole document*/
+             std::string big;
+             for (int i = 0; i < 200000; i++)
+                 big += "key" + std::to_string(i) + ":\n  value: " + std::to_string(i) + "\n";
+             big += "broken:\n  value: 'x\n";
+             LoadOptions parallel;
+             parallel.threads = 4;
+             yaml.parse(big, parallel);
+             total++; passed += assert(yaml.getParseError().code == Code::UnclosedQuote, true);
+             total++; passed += assert(yaml.getParseError().line, 400002u);
+
+             /*JSON errors carry the column too*/
+             yaml.parseJson("{\"a\": 1,\n \"b\": }");
+             total++; passed += assert(yaml.getParseError().code == Code::InvalidJson, true);
+             total++; passed += assert(yaml.getParseError().line, 2u);
+             total++; passed += assert(yaml.getParseError().column, 7u);
+
+             /*The text form is kept, the constructor throws the structured error*/
+             std::istringstream stream("a: 1\n  plain\n");
+             yaml.load(stream);
+             total++; passed += assert(yaml.getError(), std::string("invalid yaml syntax at line: 2"));
+             bool thrown = false;
+             try {
+                 Yaml missing(dirpath() + std::string("/missing.yaml"));
+             }
+             catch (const ParseException& e) {
+                 thrown = e.error().code == Code::CannotOpen;
+             }
+             total++; passed += assert(thrown, true);
+
+             /*Batch loads report the structured error of every file*/
+             std::vector<LoadResult> results = Yaml::loadMany({ dirpath() + std::string("/5.yaml"), dirpath() + std::string("/missing.yaml") }, 2);
+             total++; passed += assert(results[0].failure.ok(), true);
+             total++; passed += assert(results[1].failure.code == Code::CannotOpen, true);
+         }catch(const std::exception& e){
+             std::cerr << e.what() << std::endl;
+             return false;
+         }
+         std::cout << "-- TESTGROUP test_parse_errors RESULT: " << passed << " passed out of " << total << std::endl;
+         std::cout << "############################" << std::endl;
+         return true;
+     }
+ }}
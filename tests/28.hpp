@@ -0,0 +1,117 @@
+/**
+ * @file 28.hpp
+ * @author Mohammed Ghaith Al-Mahdawi (Mohido)
+ * @brief Tests the flow collections ([a, b], {a: 1})
+ */
+
+ #include <iostream>
+ #include <sstream>
+ #include "../yaml/yaml.hpp"
+ 
+ namespace TINY_YAML{
+ namespace tests {
+ 
+     #ifndef TINY_YAML_TESTS_HELPER_FUNCS
+     #define TINY_YAML_TESTS_HELPER_FUNCS
+         template<typename T>
+         bool assert(T v1, T v2){
+             bool result = v1 == v2;
+             std::cout << "TEST: Value (" << v1 << ") Expected to be (" << v2 << ")? " << ((result)? "passed" : "failed") << std::endl;
+             return result;
+         }
+ 
+         /// @brief - Mainly used in compile time to get the absolute path of .hpp/.cpp file parent directory
+         /// @return - Directory absolutepath of the current file.
+         std::string dirpath(){
+             std::string hppfilepath(__FILE__);
+             #if _WIN32
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("\\"));
+             #else 
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("/"));
+             #endif
+         }
+     #endif
+ 
+     bool test_28_flow_collections(){
+         int passed = 0;
+         int total = 0;
+         std::cout << "############# TESTGROUP: test_flow_collections" << std::endl;
+         try{
+             const std::string text =
+                 "list: [a, 2, \"x, y\", 'it''s']\n"
+                 "map: {x: 1, y: two, empty}\n"
+                 "nested: {a: [1, [2, 3]], b: {c: d}, e: []}   # comment\n"
+                 "items:\n"
+                 "  - [1, 2]\n"
+                 "  - {k: v}\n"
+                 "  - plain\n"
+                 "trailing: [a, b, ]\n"
+                 "url: {home: http://a.b/c}\n"
+                 "hashes: [\"c#\", \"f#\"]   # every quoted span hides its '#'\n"
+                 "\"quoted: key\": {'a: b': \"x # y\"}\n";
+
+             /*Same tree whether the text is copied (stream) or pointed into (in place)*/
+             for (int source = 0; source < 2; source++) {
+                 Yaml yaml;
+                 std::istringstream stream(text);
+                 total++; passed += assert(source == 0 ? yaml.load(stream) : yaml.parse(text), true);
+                 total++; passed += assert(yaml["list"].getSize(), 4u);
+                 total++; passed += assert(yaml["list"][0].getValue(), std::string_view("a"));
+                 total++; passed += assert(yaml["list"][2].getValue(), std::string_view("\"x, y\""));
+                 total++; passed += assert(yaml["list"][3].getValue(), std::string_view("'it''s'"));
+                 total++; passed += assert(yaml["list"].getValue(), std::string_view());
+                 total++; passed += assert(yaml["map"]["y"].getValue(), std::string_view("two"));
+                 total++; passed += assert(yaml["map"]["empty"].getScalar().isNull(), true);
+                 total++; passed += assert(yaml["nested"]["a"][1][1].getValue(), std::string_view("3"));
+                 total++; passed += assert(yaml["nested"]["b"]["c"].getValue(), std::string_view("d"));
+                 total++; passed += assert(yaml["nested"]["e"].getKind() == Node::Kind::Sequence && yaml["nested"]["e"].getSize() == 0, true);
+                 total++; passed += assert(yaml["items"][0][1].getValue(), std::string_view("2"));
+                 total++; passed += assert(yaml["items"][1]["k"].getValue(), std::string_view("v"));
+                 total++; passed += assert(yaml["items"][2].getValue(), std::string_view("plain"));
+                 total++; passed += assert(yaml["trailing"].getSize(), 2u);
+                 total++; passed += assert(yaml["url"]["home"].getValue(), std::string_view("http://a.b/c"));
+                 total++; passed += assert(yaml["hashes"].getSize(), 2u);
+                 total++; passed += assert(yaml["hashes"][1].getValue(), std::string_view("\"f#\""));
+                 total++; passed += assert(yaml["quoted: key"]["a: b"].getValue(), std::string_view("\"x # y\""));
+                 total++; passed += assert(yaml["map"].getData<std::vector<std::string>>().size(), std::size_t(0));
+                 total++; passed += assert(yaml["list"].getData<std::vector<std::string>>()[1], std::string("2"));
+             }
+
+             /*Resolved scalars*/
+             Yaml typed;
+             LoadOptions options;
+             options.resolveScalars = true;
+             typed.parse("numbers: [1, 2.5, true, ~]\n", options);
+             total++; passed += assert(typed["numbers"][0].as<int>(), 1);
+             total++; passed += assert(typed["numbers"][1].as<double>(), 2.5);
+             total++; passed += assert(typed["numbers"][2].as<bool>(), true);
+             total++; passed += assert(typed["numbers"][3].getScalar().isNull(), true);
+
+             /*Malformed collections are errors, with the column of the problem*/
+             struct Case {
+                 std::string text;
+                 ParseError::Code code;
+                 unsigned int column;
+             };
+             const Case cases[] = {
+                 { "a: [1, 2\n", ParseError::Code::InvalidFlow, 9 },
+                 { "a: [1 2] x\n", ParseError::Code::InvalidFlow, 10 },
+                 { "a: [1, , 2]\n", ParseError::Code::InvalidFlow, 8 },
+                 { "a: {x: 1, y: [2}\n", ParseError::Code::InvalidFlow, 17 },
+                 { "a: {x: 1, x: 2}\n", ParseError::Code::DuplicateKey, 11 },
+             };
+             for (const Case& test : cases) {
+                 Yaml broken;
+                 total++; passed += assert(broken.parse(test.text), false);
+                 total++; passed += assert(broken.getParseError().code == test.code, true);
+                 total++; passed += assert(broken.getParseError().column, test.column);
+             }
+         }catch(const std::exception& e){
+             std::cerr << e.what() << std::endl;
+             return false;
+         }
+         std::cout << "-- TESTGROUP test_flow_collections RESULT: " << passed << " passed out of " << total << std::endl;
+         std::cout << "############################" << std::endl;
+         return true;
+     }
+ }}
@@ -0,0 +1,57 @@
+/**
+ * @file 6.hpp
+ * @author Mohammed Ghaith Al-Mahdawi (Mohido)
+ * @brief Tests memory-mapped (zero-copy) loading
+ */
+
+ #include <iostream>
+ #include "../yaml/yaml.hpp"
+ 
+ namespace TINY_YAML{
+ namespace tests {
+ 
+     #ifndef TINY_YAML_TESTS_HELPER_FUNCS
+     #define TINY_YAML_TESTS_HELPER_FUNCS
+         template<typename T>
+         bool assert(T v1, T v2){
+             bool result = v1 == v2;
+             std::cout << "TEST: Value (" << v1 << ") Expected to be (" << v2 << ")? " << ((result)? "passed" : "failed") << std::endl;
+             return result;
+         }
+ 
+         /// @brief - Mainly used in compile time to get the absolute path of .hpp/.cpp file parent directory
+         /// @return - Directory absolutepath of the current file.
+         std::string dirpath(){
+             std::string hppfilepath(__FILE__);
+             #if _WIN32
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("\\"));
+             #else 
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("/"));
+             #endif
+         }
+     #endif
+ 
+     bool test_6_mapped_load(){
+         int passed = 0;
+         int total = 0;
+         std::cout << "############# TESTGROUP: test_mapped_load" << std::endl;
+         try{
+             Yaml yamlFile;
+             total++; passed += assert(yamlFile.loadMapped(dirpath() + std::string("/6.yaml")), true);
+             total++; passed += assert(yamlFile["object"]["name"].getValue(), std::string_view("\"mohido\""));
+             total++; passed += assert(yamlFile["object"]["property"].getValue(), std::string_view("\"cool-as#hell\""));
+             total++; passed += assert(yamlFile["version"].getData<std::string>(), std::string("1.2.3"));
+             total++; passed += assert(yamlFile["list"].getSize(), 2u);
+             total++; passed += assert(yamlFile["list"][1].getValue(), std::string_view("item2"));
+             total++; passed += assert(yamlFile["node_list"]["0"]["value"].getValue(), std::string_view("1"));
+             total++; passed += assert(yamlFile["node_list"]["1"]["extra"].getData<std::vector<std::string>>()[0], std::string("extra1"));
+             total++; passed += assert(yamlFile.loadMapped(dirpath() + std::string("/does_not_exist.yaml")), false);
+         }catch(const std::exception& e){
+             std::cerr << e.what() << std::endl;
+             return false;
+         }
+         std::cout << "-- TESTGROUP test_mapped_load RESULT: " << passed << " passed out of " << total << std::endl;
+         std::cout << "############################" << std::endl;
+         return true;
+     }
+ }}
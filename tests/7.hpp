@@ -0,0 +1,64 @@
+/**
+ * @file 7.hpp
+ * @author Mohammed Ghaith Al-Mahdawi (Mohido)
+ * @brief Tests lines longer than a read block (no line length limit)
+ */
+
+ #include <iostream>
+ #include <sstream>
+ #include "../yaml/yaml.hpp"
+ 
+ namespace TINY_YAML{
+ namespace tests {
+ 
+     #ifndef TINY_YAML_TESTS_HELPER_FUNCS
+     #define TINY_YAML_TESTS_HELPER_FUNCS
+         template<typename T>
+         bool assert(T v1, T v2){
+             bool result = v1 == v2;
+             std::cout << "TEST: Value (" << v1 << ") Expected to be (" << v2 << ")? " << ((result)? "passed" : "failed") << std::endl;
+             return result;
+         }
+ 
+         /// @brief - Mainly used in compile time to get the absolute path of .hpp/.cpp file parent directory
+         /// @return - Directory absolutepath of the current file.
+         std::string dirpath(){
+             std::string hppfilepath(__FILE__);
+             #if _WIN32
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("\\"));
+             #else 
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("/"));
+             #endif
+         }
+     #endif
+ 
+     bool test_7_long_lines(){
+         int passed = 0;
+         int total = 0;
+         std::cout << "############# TESTGROUP: test_long_lines" << std::endl;
+         try{
+             Yaml yamlFile( dirpath() + std::string("/7.yaml"));
+             total++; passed += assert(yamlFile["blob"].getValue().size(), std::size_t(4000));
+             total++; passed += assert(yamlFile["blob"].getValue().substr(3996), std::string_view("dtw1"));
+             total++; passed += assert(yamlFile["object"]["flow"].getValue().size(), std::size_t(1342));
+             total++; passed += assert(yamlFile["object"]["after"].getData<std::string>(), std::string("\"still parsed\""));
+             total++; passed += assert(yamlFile["last"].getData<std::string>(), std::string("end"));
+
+             // A tiny block size forces lines to cross block boundaries and the buffer to grow.
+             std::istringstream stream("a: 1\n" + std::string(100, 'x') + "\n\nlast");
+             LineReader reader(stream, 8);
+             std::string_view line;
+             total++; passed += assert(reader.next(line) && line == "a: 1", true);
+             total++; passed += assert(reader.next(line) && line == std::string(100, 'x'), true);
+             total++; passed += assert(reader.next(line) && line.empty(), true);
+             total++; passed += assert(reader.next(line) && line == "last", true);
+             total++; passed += assert(reader.next(line), false);
+         }catch(const std::exception& e){
+             std::cerr << e.what() << std::endl;
+             return false;
+         }
+         std::cout << "-- TESTGROUP test_long_lines RESULT: " << passed << " passed out of " << total << std::endl;
+         std::cout << "############################" << std::endl;
+         return true;
+     }
+ }}
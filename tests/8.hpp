@@ -0,0 +1,87 @@
+/**
+ * @file 8.hpp
+ * @author Mohammed Ghaith Al-Mahdawi (Mohido)
+ * @brief Tests the structural character scanner (every instruction set must agree)
+ */
+
+ #include <iostream>
+ #include <fstream>
+ #include <memory>
+ #include <cstring>
+ #include "../yaml/yaml.hpp"
+ #include "../yaml/scanner.hpp"
+ 
+ namespace TINY_YAML{
+ namespace tests {
+ 
+     #ifndef TINY_YAML_TESTS_HELPER_FUNCS
+     #define TINY_YAML_TESTS_HELPER_FUNCS
+         template<typename T>
+         bool assert(T v1, T v2){
+             bool result = v1 == v2;
+             std::cout << "TEST: Value (" << v1 << ") Expected to be (" << v2 << ")? " << ((result)? "passed" : "failed") << std::endl;
+             return result;
+         }
+ 
+         /// @brief - Mainly used in compile time to get the absolute path of .hpp/.cpp file parent directory
+         /// @return - Directory absolutepath of the current file.
+         std::string dirpath(){
+             std::string hppfilepath(__FILE__);
+             #if _WIN32
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("\\"));
+             #else 
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("/"));
+             #endif
+         }
+     #endif
+ 
+     bool test_8_scanner(){
+         int passed = 0;
+         int total = 0;
+         std::cout << "############# TESTGROUP: test_scanner" << std::endl;
+         try{
+             Yaml yamlFile( dirpath() + std::string("/8.yaml"));
+             total++; passed += assert(yamlFile["escaped"].getData<std::string>(), std::string("\"a \\\"quoted\\\" word\""));
+             total++; passed += assert(yamlFile["crossing"].getValue().substr(71), std::string_view("#not-a-comment\""));
+             total++; passed += assert(yamlFile["dash_inside"].getData<std::string>(), std::string("'a-b-c'"));
+             total++; passed += assert(yamlFile[std::string(60, 'x') + "_key"].getData<std::string>(), std::string("\"value\""));
+
+             // Every supported instruction set must find the same textmarks.
+             ScanLevel best = detectScanLevel();
+             std::ifstream file(dirpath() + std::string("/8.yaml"));
+             std::string line;
+             int mismatches = 0;
+             while (std::getline(file, line)) {
+                 LineMarks scalar, simd;
+                 for (ScanLevel level : { ScanLevel::SSE2, ScanLevel::AVX2 }) {
+                     if (static_cast<int>(level) > static_cast<int>(best))
+                         continue;
+                     bool okScalar = scanLine(line, scalar, ScanLevel::Scalar);
+                     bool okSimd = scanLine(line, simd, level);
+                     mismatches += okScalar != okSimd || scalar.hash != simd.hash || scalar.dash != simd.dash || scalar.colon != simd.colon
+                         || scalar.fstQuote != simd.fstQuote || scalar.lstQuote != simd.lstQuote || scalar.firstChar != simd.firstChar || scalar.lastChar != simd.lastChar;
+                 }
+             }
+             total++; passed += assert(mismatches, 0);
+
+             LineMarks marks;
+             total++; passed += assert(scanLine("key: \"unclosed", marks), false);
+             total++; passed += assert(scanLine("  - item # note-1", marks) && marks.dash == 2 && marks.hash == 9 && marks.lastChar == 7, true);
+
+             // A dash inside the comment is not a list mark (the line is cut at the comment before the dash is checked).
+             total++; passed += assert(scanLine("a: b #-", marks) && marks.dash == std::string_view::npos, true);
+             const std::string_view commented("a: b #-");
+             std::unique_ptr<char[]> exact(new char[commented.size()]);
+             std::memcpy(exact.get(), commented.data(), commented.size());
+             Yaml inPlace;
+             total++; passed += assert(inPlace.parse(std::string_view(exact.get(), commented.size())), true);
+             total++; passed += assert(inPlace["a"].getValue(), std::string_view("b"));
+         }catch(const std::exception& e){
+             std::cerr << e.what() << std::endl;
+             return false;
+         }
+         std::cout << "-- TESTGROUP test_scanner RESULT: " << passed << " passed out of " << total << std::endl;
+         std::cout << "############################" << std::endl;
+         return true;
+     }
+ }}
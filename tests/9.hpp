@@ -0,0 +1,96 @@
+/**
+ * @file 9.hpp
+ * @author Mohammed Ghaith Al-Mahdawi (Mohido)
+ * @brief Tests typed scalar values (resolved during loading)
+ */
+
+ #include <iostream>
+ #include <cmath>
+ #include "../yaml/yaml.hpp"
+ 
+ namespace TINY_YAML{
+ namespace tests {
+ 
+     #ifndef TINY_YAML_TESTS_HELPER_FUNCS
+     #define TINY_YAML_TESTS_HELPER_FUNCS
+         template<typename T>
+         bool assert(T v1, T v2){
+             bool result = v1 == v2;
+             std::cout << "TEST: Value (" << v1 << ") Expected to be (" << v2 << ")? " << ((result)? "passed" : "failed") << std::endl;
+             return result;
+         }
+ 
+         /// @brief - Mainly used in compile time to get the absolute path of .hpp/.cpp file parent directory
+         /// @return - Directory absolutepath of the current file.
+         std::string dirpath(){
+             std::string hppfilepath(__FILE__);
+             #if _WIN32
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("\\"));
+             #else 
+                 return hppfilepath.substr(0, hppfilepath.find_last_of("/"));
+             #endif
+         }
+     #endif
+ 
+     bool test_9_typed_values(){
+         int passed = 0;
+         int total = 0;
+         std::cout << "############# TESTGROUP: test_typed_values" << std::endl;
+         try{
+             LoadOptions options;
+             options.resolveScalars = true;
+             Yaml yamlFile( dirpath() + std::string("/9.yaml"), options);
+             total++; passed += assert(yamlFile["count"].getScalar().type() == Value::Type::Int, true);
+             total++; passed += assert(yamlFile["count"].as<std::int64_t>(), std::int64_t(123));
+             total++; passed += assert(yamlFile["count"].as<double>(), 123.0);
+             total++; passed += assert(yamlFile["negative"].as<int>(), -42);
+             total++; passed += assert(yamlFile["hex"].as<int>(), 31);
+             total++; passed += assert(yamlFile["ratio"].as<double>(), 0.25);
+             total++; passed += assert(yamlFile["exponent"].getScalar().type() == Value::Type::Double, true);
+             total++; passed += assert(yamlFile["exponent"].as<double>(), 1000.0);
+             total++; passed += assert(std::isinf(yamlFile["infinite"].as<double>()) && yamlFile["infinite"].as<double>() < 0, true);
+             total++; passed += assert(yamlFile["enabled"].as<bool>(), true);
+             total++; passed += assert(yamlFile["disabled"].as<bool>(), false);
+             total++; passed += assert(yamlFile["nothing"].getScalar().isNull(), true);
+             total++; passed += assert(yamlFile["version"].getScalar().type() == Value::Type::String, true);
+             total++; passed += assert(yamlFile["version"].as<std::string_view>(), std::string_view("1.2.3"));
+             total++; passed += assert(yamlFile["quoted"].getScalar().type() == Value::Type::String, true);
+             total++; passed += assert(yamlFile["quoted"].as<std::string_view>(), std::string_view("123"));
+             total++; passed += assert(yamlFile["quoted"].getValue(), std::string_view("\"123\""));
+             total++; passed += assert(yamlFile["escaped"].as<std::string_view>(), std::string_view("tab\there"));
+             total++; passed += assert(yamlFile["object"]["name"].as<std::string_view>(), std::string_view("plain text"));
+
+             bool thrown = false;
+             try { yamlFile["version"].as<int>(); } catch (const std::runtime_error&) { thrown = true; }
+             total++; passed += assert(thrown, true);
+
+            // Integers that do not fit the requested type are rejected.
+            Value big("300"), minus("-1"), huge("99999999999");
+            total++; passed += assert(big.as<int>(), 300);
+            int rejected = 0;
+            try { big.as<std::uint8_t>(); } catch (const std::runtime_error&) { rejected++; }
+            try { minus.as<unsigned>(); } catch (const std::runtime_error&) { rejected++; }
+            try { huge.as<int>(); } catch (const std::runtime_error&) { rejected++; }
+            total++; passed += assert(rejected, 3);
+            total++; passed += assert(huge.as<std::int64_t>(), std::int64_t(99999999999));
+
+             // Without resolution the values are converted on access.
+             Yaml rawFile( dirpath() + std::string("/9.yaml"));
+             total++; passed += assert(rawFile["count"].getScalar().type() == Value::Type::Raw, true);
+             total++; passed += assert(rawFile["count"].as<int>(), 123);
+             total++; passed += assert(rawFile["enabled"].as<bool>(), true);
+             total++; passed += assert(rawFile["quoted"].as<std::string_view>(), std::string_view("123"));
+            thrown = false;
+            try { rawFile["escaped"].as<std::string_view>(); } catch (const std::runtime_error&) { thrown = true; }
+            total++; passed += assert(thrown, true);
+            Arena scratch;
+            total++; passed += assert(Value::unquote(rawFile["escaped"].getValue(), scratch), std::string_view("tab\there"));
+         }catch(const std::exception& e){
+             std::cerr << e.what() << std::endl;
+             return false;
+         }
+         std::cout << "-- TESTGROUP test_typed_values RESULT: " << passed << " passed out of " << total << std::endl;
+         std::cout << "############################" << std::endl;
+         return true;
+     }
+ }}
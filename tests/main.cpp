@@ -3,6 +3,29 @@
 #include "3.hpp"    // Test yaml lists
 #include "4.hpp"    // Test yaml object lists
 #include "5.hpp"    // Test yaml nested complex object
+#include "6.hpp"    // Test memory-mapped loading
+#include "7.hpp"    // Test lines longer than a read block
+#include "8.hpp"    // Test the structural character scanner
+#include "9.hpp"    // Test typed scalar values
+#include "10.hpp"   // Test the flat child list
+#include "11.hpp"   // Test pre-compiled paths
+#include "12.hpp"   // Test sequence nodes
+#include "13.hpp"   // Test loading many files concurrently
+#include "14.hpp"   // Test parsing one document on several threads
+#include "15.hpp"   // Test parsing from memory and streams
+#include "16.hpp"   // Test the push parser events
+#include "17.hpp"   // Test multi-document streams
+#include "18.hpp"   // Test lazy loading
+#include "19.hpp"   // Test reloading snapshots
+#include "20.hpp"   // Test binary images
+#include "21.hpp"   // Test saving documents
+#include "22.hpp"   // Test JSON transcoding and parsing
+#include "23.hpp"   // Test load statistics
+#include "24.hpp"   // Test binding documents to structs
+#include "25.hpp"   // Test concurrent readers
+#include "26.hpp"   // Test key interning
+#include "27.hpp"   // Test structured load errors
+#include "28.hpp"   // Test flow collections
 
 
 int main(int argc, char** argv) {
@@ -11,5 +34,28 @@ int main(int argc, char** argv) {
     TINY_YAML::tests::test_3_basic_list();
     TINY_YAML::tests::test_4_basic_object_list();
     TINY_YAML::tests::test_5_complex_nested_object();
+    TINY_YAML::tests::test_6_mapped_load();
+    TINY_YAML::tests::test_7_long_lines();
+    TINY_YAML::tests::test_8_scanner();
+    TINY_YAML::tests::test_9_typed_values();
+    TINY_YAML::tests::test_10_children();
+    TINY_YAML::tests::test_11_compiled_paths();
+    TINY_YAML::tests::test_12_sequences();
+    TINY_YAML::tests::test_13_load_many();
+    TINY_YAML::tests::test_14_parallel_load();
+    TINY_YAML::tests::test_15_memory_sources();
+    TINY_YAML::tests::test_16_events();
+    TINY_YAML::tests::test_17_documents();
+    TINY_YAML::tests::test_18_lazy_load();
+    TINY_YAML::tests::test_19_reload();
+    TINY_YAML::tests::test_20_binary_image();
+    TINY_YAML::tests::test_21_save();
+    TINY_YAML::tests::test_22_json();
+    TINY_YAML::tests::test_23_stats();
+    TINY_YAML::tests::test_24_binding();
+    TINY_YAML::tests::test_25_concurrent_reads();
+    TINY_YAML::tests::test_26_key_pool();
+    TINY_YAML::tests::test_27_parse_errors();
+    TINY_YAML::tests::test_28_flow_collections();
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,279 @@
+/**
+* Module: Tiny Yaml parser
+* Official Remote Repository: https://github.com/Mohido/Tiny_Yaml.git
+*
+* Binary image of a parsed tree (Yaml::saveBinary/loadBinary/loadCached).
+* Layout, in the byte order of the machine that wrote it:
+*	- ImageHeader
+*	- ImageRecord per node (24 bytes), in pre-order. The first record is the virtual root node. The children of a record follow it.
+*	- Key text: every distinct key once, referenced by offset.
+*	- Value text: the values one after the other in the order of the records, so a record only holds their size. The content of a
+*	  String value points into its raw text (quotes dropped); only the strings with escapes add their unescaped content after it.
+* Loading maps the file, checks every offset and rebuilds the nodes in one pass. Nothing is scanned or copied, and typed values come resolved.
+* The records are not queried in place: Node is the only lookup structure, so every record still becomes a node in the arena and
+* loading stays linear in the size of the document, only cheaper than parsing it.
+*/
+#include "yaml.hpp"
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <cstring>
+#include <fstream>
+#include <filesystem>
+#include <cstdio>
+#include <system_error>
+
+namespace TINY_YAML {
+
+	namespace {
+
+		constexpr char IMAGE_MAGIC[8] = { 'T', 'Y', 'A', 'M', 'L', 'B', 'I', 'N' };
+		constexpr std::uint32_t IMAGE_VERSION = 2;
+		constexpr std::uint32_t IMAGE_BYTE_ORDER = 0x01020304;
+
+
+		struct ImageHeader {
+			char magic[8];
+			std::uint32_t version;
+			std::uint32_t byteOrder;													// IMAGE_BYTE_ORDER as written by the machine
+			std::uint64_t sourceSize;													// Size of the yaml file (loadCached), 0 otherwise
+			std::int64_t sourceTime;													// Last write time of the yaml file (loadCached), 0 otherwise
+			std::uint64_t records;
+			std::uint64_t keySize;														// Size of the key text
+			std::uint64_t valueSize;													// Size of the value text
+			std::uint32_t resolved;														// Whether the scalars were resolved (LoadOptions::resolveScalars)
+			std::uint32_t reserved;
+		};
+
+
+		struct ImageRecord {
+			std::uint32_t key;															// Offset into the key text
+			std::uint32_t keySize;
+			std::uint32_t valueSize;													// The value starts where the one of the previous record ends
+			std::uint8_t kind;															// Node::Kind
+			std::uint8_t type;															// Value::Type
+			std::uint8_t padding[2];
+			std::uint32_t payload[2];													// Collection: number of children. String: offset (from the value) and size of the content. Bool/Int/Double: bits of the value
+		};
+
+
+		/// Number of bytes of the value text used by the record: its value, and the content of a String value when it is not inside the value
+		std::uint64_t valueBytes(const ImageRecord& record) {
+			if (record.type != static_cast<std::uint8_t>(Value::Type::String))
+				return record.valueSize;
+			return std::max<std::uint64_t>(record.valueSize, std::uint64_t(record.payload[0]) + record.payload[1]);
+		}
+
+
+		/// Stamp of the yaml file checked by loadCached
+		bool sourceStamp(const std::string& filepath, std::uint64_t& size, std::int64_t& time) {
+			std::error_code error;
+			size = std::filesystem::file_size(filepath, error);
+			if (error)
+				return false;
+			auto written = std::filesystem::last_write_time(filepath, error);
+			if (error)
+				return false;
+			time = static_cast<std::int64_t>(written.time_since_epoch().count());
+			return true;
+		}
+	}
+
+
+	bool Yaml::saveBinary(const std::string& filepath) {
+		return writeImage(filepath, 0, 0);
+	}
+
+
+	bool Yaml::loadBinary(const std::string& filepath) {
+		return readImage(filepath, 0, 0);
+	}
+
+
+	bool Yaml::loadCached(const std::string& filepath, const LoadOptions& options) {
+		std::string cache = filepath + ".tyc";
+		std::uint64_t size = 0;
+		std::int64_t time = 0;
+		if (!sourceStamp(filepath, size, time))
+			return load(filepath, options);
+
+		/*The options change the content of the image: only resolveScalars is recorded, lazy/threaded loads are simply not cached*/
+		bool cacheable = !options.lazy && options.threads == 1;
+		if (cacheable) {
+			this->m_options = options;
+			if (readImage(cache, size, time))
+				return true;
+		}
+		if (!load(filepath, options))
+			return false;
+		if (cacheable)
+			writeImage(cache, size, time);		// A cache that can not be written only costs the next start
+		return true;
+	}
+
+
+	bool Yaml::writeImage(const std::string& filepath, std::uint64_t sourceSize, std::int64_t sourceTime) {
+		/*Flatten the tree in pre-order. Offsets are 32 bits: a tree with more than 4 GiB of text is not written*/
+		std::vector<ImageRecord> records;
+		std::string keys;
+		std::string values;
+		std::unordered_map<std::string_view, std::uint32_t> keyOffsets;		// Every distinct key is written once
+		std::vector<const Node*> pending(1, this->m_roots);
+		while (!pending.empty()) {
+			const Node* node = pending.back();
+			pending.pop_back();
+			node->expand();
+
+			ImageRecord record = {};
+			const Value& value = node->m_value;
+			auto key = keyOffsets.emplace(node->m_identifier, static_cast<std::uint32_t>(keys.size()));
+			if (key.second)
+				keys.append(node->m_identifier.data(), node->m_identifier.size());
+			record.key = key.first->second;
+			record.keySize = static_cast<std::uint32_t>(node->m_identifier.size());
+			record.valueSize = static_cast<std::uint32_t>(value.text().size());
+			record.kind = static_cast<std::uint8_t>(node->m_kind);
+			record.type = static_cast<std::uint8_t>(value.type());
+			std::size_t start = values.size();
+			values.append(value.text().data(), value.text().size());
+			if (node->m_kind != Node::Kind::Scalar)
+				record.payload[0] = node->m_children.size();
+			else if (value.type() == Value::Type::String) {
+				/*Plain and quoted strings without escapes are a part of their raw text*/
+				std::string_view content = value.as<std::string_view>();
+				std::string_view text = value.text();
+				std::less<const char*> before;
+				bool inside = content.empty() || (!before(content.data(), text.data()) && !before(text.data() + text.size(), content.data() + content.size()));
+				std::size_t offset = content.empty() ? 0 : inside ? static_cast<std::size_t>(content.data() - text.data()) : text.size();
+				if (!inside)
+					values.append(content.data(), content.size());
+				record.payload[0] = static_cast<std::uint32_t>(offset);
+				record.payload[1] = static_cast<std::uint32_t>(content.size());
+			}
+			else if (value.type() == Value::Type::Bool || value.type() == Value::Type::Int || value.type() == Value::Type::Double)
+				std::memcpy(record.payload, &value.m_int, sizeof(record.payload));
+			if (keys.size() > std::numeric_limits<std::uint32_t>::max() || values.size() - start > std::numeric_limits<std::uint32_t>::max()) {
+				this->m_error = filepath + " cannot be written: the text is too big for a binary image";
+				return false;
+			}
+			records.push_back(record);
+
+			for (std::uint32_t i = node->m_children.size(); i > 0; i--)		// Reversed, so the first child is written first
+				pending.push_back(node->m_children.at(i - 1));
+		}
+
+		ImageHeader header = {};
+		std::memcpy(header.magic, IMAGE_MAGIC, sizeof(IMAGE_MAGIC));
+		header.version = IMAGE_VERSION;
+		header.byteOrder = IMAGE_BYTE_ORDER;
+		header.sourceSize = sourceSize;
+		header.sourceTime = sourceTime;
+		header.records = records.size();
+		header.keySize = keys.size();
+		header.valueSize = values.size();
+		header.resolved = this->m_options.resolveScalars;
+
+		/*Written next to the target and renamed, so a reader never maps half an image*/
+		std::string temporary = filepath + ".tmp";
+		{
+			std::ofstream file(temporary, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+			file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+			file.write(reinterpret_cast<const char*>(records.data()), records.size() * sizeof(ImageRecord));
+			file.write(keys.data(), keys.size());
+			file.write(values.data(), values.size());
+			if (!file) {
+				this->m_error = filepath + " cannot be written";
+				std::remove(temporary.c_str());
+				return false;
+			}
+		}
+		std::error_code error;
+		std::filesystem::rename(temporary, filepath, error);
+		if (error) {
+			this->m_error = filepath + " cannot be written";
+			std::remove(temporary.c_str());
+			return false;
+		}
+		return true;
+	}
+
+
+	bool Yaml::readImage(const std::string& filepath, std::uint64_t sourceSize, std::int64_t sourceTime) {
+		/*Variables*/
+		LoadOptions options = this->m_options;
+		reset();
+		this->m_copyText = false;
+
+		if (!this->m_mapping.open(filepath))
+			return fail(ParseError::Code::CannotMap, filepath + " cannot be mapped");
+
+		/*Check the header, then every record against the size of the image*/
+		std::string_view image = this->m_mapping.view();
+		ImageHeader header;
+		if (image.size() < sizeof(header))
+			return fail(ParseError::Code::InvalidImage, filepath + " is not a binary yaml image");
+		std::memcpy(&header, image.data(), sizeof(header));
+		std::uint64_t texts = image.size() - sizeof(header);
+		bool valid = std::memcmp(header.magic, IMAGE_MAGIC, sizeof(IMAGE_MAGIC)) == 0 && header.version == IMAGE_VERSION && header.byteOrder == IMAGE_BYTE_ORDER
+			&& header.records != 0 && header.records <= texts / sizeof(ImageRecord);
+		texts -= valid ? header.records * sizeof(ImageRecord) : 0;
+		valid = valid && header.keySize <= texts && header.valueSize == texts - header.keySize;
+		if (!valid)
+			return fail(ParseError::Code::InvalidImage, filepath + " is not a binary yaml image");
+		if (sourceSize != 0 && (header.sourceSize != sourceSize || header.sourceTime != sourceTime || (header.resolved != 0) != options.resolveScalars))
+			return fail(ParseError::Code::InvalidImage, filepath + " does not match its yaml file");
+		this->m_options = options;
+		this->m_options.resolveScalars = header.resolved != 0;
+
+		const char* records = image.data() + sizeof(header);
+		std::string_view keys = image.substr(sizeof(header) + header.records * sizeof(ImageRecord), header.keySize);
+		std::string_view values = image.substr(sizeof(header) + header.records * sizeof(ImageRecord) + header.keySize);
+		std::uint64_t cursor = 0;				// Start of the value of the next record
+
+		/*Rebuild the nodes in pre-order. The stack holds the parents and how many children they still expect*/
+		std::vector<std::pair<Node*, std::uint32_t>> parents;
+		for (std::uint64_t i = 0; i < header.records && valid; i++) {
+			ImageRecord record;
+			std::memcpy(&record, records + i * sizeof(ImageRecord), sizeof(record));
+			bool scalar = record.kind == static_cast<std::uint8_t>(Node::Kind::Scalar);
+			std::uint64_t bytes = valueBytes(record);
+			valid = record.key <= keys.size() && record.keySize <= keys.size() - record.key && bytes <= values.size() - cursor
+				&& record.kind <= static_cast<std::uint8_t>(Node::Kind::Sequence) && record.type <= static_cast<std::uint8_t>(Value::Type::String)
+				&& (scalar || (record.valueSize == 0 && record.type == static_cast<std::uint8_t>(Value::Type::Raw) && record.payload[0] < header.records - i))
+				&& (i == 0) != !parents.empty();
+			if (!valid)
+				break;
+			std::string_view key = (record.keySize == 0) ? std::string_view() : keys.substr(record.key, record.keySize);
+			std::string_view value = (record.valueSize == 0) ? std::string_view() : values.substr(cursor, record.valueSize);
+
+			Node* node = this->m_roots;
+			if (i != 0) {
+				node = this->m_arena->create<Node>(key, value, *this->m_arena);
+				Node* parent = parents.back().first;
+				valid = (parent->m_kind == Node::Kind::Sequence) ? parent->push(node) : parent->append(node);
+				if (--parents.back().second == 0)
+					parents.pop_back();
+			}
+			node->m_kind = static_cast<Node::Kind>(record.kind);
+			node->m_value = Value(value);
+			node->m_value.m_type = static_cast<Value::Type>(record.type);
+			if (node->m_value.m_type == Value::Type::String)
+				node->m_value.m_string = { values.data() + cursor + record.payload[0], record.payload[1] };
+			else if (node->m_value.m_type != Value::Type::Raw && node->m_value.m_type != Value::Type::Null)
+				std::memcpy(&node->m_value.m_int, record.payload, sizeof(record.payload));
+			if (!scalar && record.payload[0] != 0) {
+				node->m_children.reserve(record.payload[0]);		// Grown once, to its final size
+				parents.emplace_back(node, record.payload[0]);
+			}
+			cursor += bytes;
+		}
+
+		if (!valid || !parents.empty() || cursor != values.size())
+			return fail(ParseError::Code::InvalidImage, filepath + " is not a binary yaml image");
+		return true;
+	}
+}
@@ -0,0 +1,195 @@
+/**
+* Module: Tiny Yaml parser
+* Official Remote Repository: https://github.com/Mohido/Tiny_Yaml.git
+*
+* Binding of documents to C++ structs: an EventHandler walking the type tables of binding::opsOf<T>() alongside the events.
+*/
+#include "yaml.hpp"
+
+#include <string>
+#include <vector>
+
+namespace TINY_YAML {
+namespace binding {
+
+	namespace {
+		/// Receives the events and fills the objects. After the first error the events are ignored.
+		class Binder : public EventHandler {
+		private:
+			struct Frame {
+				void* object;																// Struct or vector being filled
+				const TypeOps* ops;															// nullptr while content without a field is skipped
+				std::string segment;														// Key or index of the frame in its parent
+				std::uint64_t seen = 0;														// Fields found (structs)
+				std::size_t items = 0;														// Items appended (sequences)
+			};
+
+			std::vector<Frame> m_frames;
+			void* m_target;																	// Object receiving the next value (nullptr: skip it)
+			const TypeOps* m_targetOps;
+			std::string m_segment;															// Key of the next value
+			Arena m_scratch;																// Unescaped strings of the current scalar
+			const EventParser* m_parser = nullptr;
+			std::string m_error;
+
+			/// Object of the next value, with its optionals constructed. False if the value is skipped.
+			bool next(void*& object, const TypeOps*& ops, bool null) {
+				if (!this->m_frames.empty() && this->m_frames.back().ops == nullptr)
+					return false;
+				if (!this->m_frames.empty() && this->m_frames.back().ops->kind == TypeOps::Kind::Sequence) {
+					Frame& sequence = this->m_frames.back();
+					this->m_segment = std::to_string(sequence.items++);
+					object = sequence.ops->emplace(sequence.object, ops);
+				}
+				else {
+					object = this->m_target;
+					ops = this->m_targetOps;
+					this->m_target = nullptr;
+				}
+				while (object != nullptr && ops->kind == TypeOps::Kind::Optional)
+					object = null ? nullptr : ops->emplace(object, ops);		// A null value leaves the optional empty
+				return object != nullptr;
+			}
+
+			std::string path() const {
+				std::string result;
+				for (const Frame& frame : this->m_frames) {
+					if (!frame.segment.empty())
+						result += (result.empty() ? "" : ".") + frame.segment;
+				}
+				return result;
+			}
+
+			void fail(const std::string& segment, const std::string& what) {
+				std::string where = path();
+				if (!segment.empty())
+					where += (where.empty() ? "" : ".") + segment;
+				this->m_error = (where.empty() ? "document" : where) + ": " + what + " at line " + std::to_string(this->m_parser->getLine());
+			}
+
+			/// Reports the first required field the struct did not get
+			void checkFields(const TypeOps& ops, std::uint64_t seen, const std::string& segment) {
+				std::uint64_t missing = ops.required & ~seen;
+				if (missing == 0)
+					return;
+				std::size_t index = 0;
+				while ((missing & 1) == 0) {
+					missing >>= 1;
+					index++;
+				}
+				fail(segment, "missing field '" + std::string(ops.fieldName(index)) + "'");
+			}
+
+			void start(TypeOps::Kind kind, const char* got) {
+				if (!this->m_error.empty())
+					return;
+				void* object;
+				const TypeOps* ops;
+				if (!next(object, ops, false)) {
+					this->m_frames.push_back({ nullptr, nullptr, this->m_segment });
+					return;
+				}
+				if (ops->kind != kind) {
+					fail(this->m_segment, std::string("expected ") + ops->expected + ", got " + got);
+					return;
+				}
+				this->m_frames.push_back({ object, ops, this->m_segment });
+			}
+
+		public:
+			Binder(void* object, const TypeOps& ops)
+			: m_target(object), m_targetOps(&ops)
+			{}
+
+			void setParser(const EventParser& parser) {
+				this->m_parser = &parser;
+			}
+
+			const std::string& getError() const {
+				return this->m_error;
+			}
+
+			/// The first error is the one reported, the rest of the stream is not read
+			bool stopped() const override {
+				return !this->m_error.empty();
+			}
+
+			void startMapping() override {
+				start(TypeOps::Kind::Struct, "a mapping");
+			}
+
+			void startSequence() override {
+				start(TypeOps::Kind::Sequence, "a sequence");
+			}
+
+			void end() override {
+				if (!this->m_error.empty())
+					return;
+				Frame frame = std::move(this->m_frames.back());
+				this->m_frames.pop_back();
+				if (frame.ops != nullptr && frame.ops->kind == TypeOps::Kind::Struct)
+					checkFields(*frame.ops, frame.seen, frame.segment);
+			}
+
+			void key(std::string_view key) override {
+				if (!this->m_error.empty() || this->m_frames.back().ops == nullptr)
+					return;
+				Frame& frame = this->m_frames.back();
+				this->m_segment = Value::unquote(key, this->m_scratch);
+				this->m_scratch.rewind();
+
+				std::size_t index;
+				if (frame.ops->field(frame.object, this->m_segment, this->m_target, this->m_targetOps, index))
+					frame.seen |= std::uint64_t(1) << index;
+				else
+					this->m_target = nullptr;		// No such field, the value is skipped
+			}
+
+			void scalar(std::string_view value) override {
+				if (!this->m_error.empty())
+					return;
+				void* object;
+				const TypeOps* ops;
+				if (!next(object, ops, Value(value).isNull()))
+					return;
+				switch (ops->kind) {
+				case TypeOps::Kind::Scalar:
+					if (!ops->scalar(object, value, this->m_scratch))
+						fail(this->m_segment, std::string("expected ") + ops->expected + ", got \"" + std::string(value) + "\"");
+					this->m_scratch.rewind();
+					break;
+				case TypeOps::Kind::Sequence:			// `key:` without items is an empty sequence
+					if (!value.empty())
+						fail(this->m_segment, "expected a sequence, got \"" + std::string(value) + "\"");
+					break;
+				default:								// `key:` without fields is an empty mapping
+					if (!value.empty())
+						fail(this->m_segment, "expected a mapping, got \"" + std::string(value) + "\"");
+					else
+						checkFields(*ops, 0, this->m_segment);
+					break;
+				}
+			}
+		};
+	}
+
+
+	bool bindStream(std::istream& stream, void* object, const TypeOps& ops, std::string& error) {
+		Binder binder(object, ops);
+		EventParser parser(binder);
+		binder.setParser(parser);
+		bool ok = parser.feed(stream) && binder.getError().empty() && parser.finish();
+		error = !binder.getError().empty() ? binder.getError() : parser.getError();
+		return ok && error.empty();
+	}
+
+
+	bool bindText(std::string_view text, void* object, const TypeOps& ops, std::string& error) {
+		Binder binder(object, ops);
+		EventParser parser(binder);
+		binder.setParser(parser);
+		bool ok = parser.feed(text) && binder.getError().empty() && parser.finish();
+		error = !binder.getError().empty() ? binder.getError() : parser.getError();
+		return ok && error.empty();
+	}
+}}
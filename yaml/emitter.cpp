@@ -0,0 +1,232 @@
+/**
+* Module: Tiny Yaml parser
+* Official Remote Repository: https://github.com/Mohido/Tiny_Yaml.git
+*
+* Block style emitter (Yaml::save) and its buffered Writer.
+* Keys and values are written as they were read (quotes included), so a saved document loads back into the same tree.
+* Only text that can not be written plain (line breaks, blanks at the ends, textmarks, empty items) is double quoted.
+* Empty collections and the sequences nested in sequences are written in flow style (`[]`, `{}`, `- [a, b]`).
+*/
+#include "yaml.hpp"
+
+#include <string>
+#include <cstring>
+#include <fstream>
+#include <algorithm>
+
+namespace TINY_YAML {
+
+	/////////////////////////////// WRITER METHODS ///////////////////////////////
+	Writer::Writer(std::ostream& stream, std::size_t blockSize)
+	: m_stream(stream), m_buffer(std::max<std::size_t>(blockSize, 1))
+	{}
+
+
+	Writer::~Writer() {
+		flush();
+	}
+
+
+	void Writer::write(std::string_view text) {
+		if (text.size() > this->m_buffer.size() - this->m_size) {
+			flush();
+			if (text.size() >= this->m_buffer.size()) {		// Bigger than the whole buffer, no need to copy it
+				this->m_stream.write(text.data(), text.size());
+				return;
+			}
+		}
+		std::memcpy(this->m_buffer.data() + this->m_size, text.data(), text.size());
+		this->m_size += text.size();
+	}
+
+
+	void Writer::indent(std::size_t columns) {
+		static const std::string_view spaces = "                                                                ";
+		while (columns != 0) {
+			std::size_t count = std::min(columns, spaces.size());
+			write(spaces.substr(0, count));
+			columns -= count;
+		}
+	}
+
+
+	bool Writer::flush() {
+		if (this->m_size != 0)
+			this->m_stream.write(this->m_buffer.data(), this->m_size);
+		this->m_size = 0;
+		return static_cast<bool>(this->m_stream);
+	}
+
+
+	/////////////////////////////// EMITTER ///////////////////////////////
+	namespace {
+
+		/// Where a scalar is written, each place has its own textmarks
+		enum class Place {
+			Key,			// `key: `
+			Value,			// `key: value`
+			Item,			// `- item`
+			Flow,			// Inside `[..]` or `{..}`
+			FlowKey			// `{key: ..}`
+		};
+
+
+		/// One quoted scalar, as read from a document: written as is
+		bool isQuotedScalar(std::string_view text) {
+			if (text.size() < 2 || (text[0] != '"' && text[0] != '\''))
+				return false;
+			for (std::size_t i = 1; i < text.size(); i++) {
+				if (text[0] == '"' && text[i] == '\\')
+					i++;
+				else if (text[i] == text[0]) {
+					if (text[0] == '\'' && i + 1 < text.size() && text[i + 1] == '\'')		// '' in a single quoted scalar
+						i++;
+					else
+						return i == text.size() - 1;
+				}
+			}
+			return false;
+		}
+
+
+		bool needsQuotes(std::string_view text, Place place) {
+			if (text.empty())
+				return place != Place::Value;				// An empty value is written as nothing (null)
+			/*Values are kept as written, keys are stored without their quotes: one that looks quoted must be quoted again*/
+			bool key = place == Place::Key || place == Place::FlowKey;
+			if (!key && isQuotedScalar(text))
+				return false;
+			if (text.front() == ' ' || text.front() == '\t' || text.back() == ' ' || text.back() == '\t')
+				return true;
+			/*Quotes and '#' would open a quoted span or a comment, a leading '[' or '{' a flow collection, a leading `- ` an item*/
+			if (text.find_first_of("\n\r\"'#") != std::string_view::npos || text.front() == '[' || text.front() == '{')
+				return true;
+			if (text.front() == '-' && (text.size() == 1 || text[1] == ' ' || text[1] == '\t'))
+				return true;
+			if (place != Place::Value && text.find(':') != std::string_view::npos)
+				return true;
+			return (place == Place::Flow || place == Place::FlowKey) && text.find_first_of(",[]{}") != std::string_view::npos;
+		}
+
+
+		void writeScalar(std::string_view text, Place place, Writer& writer) {
+			if (!needsQuotes(text, place)) {
+				writer.write(text);
+				return;
+			}
+			writer.put('"');
+			for (char c : text) {
+				switch (c) {
+				case '\n': writer.write("\\n"); break;
+				case '\r': writer.write("\\r"); break;
+				case '\t': writer.write("\\t"); break;
+				case '"': writer.write("\\\""); break;
+				case '\\': writer.write("\\\\"); break;
+				default: writer.put(c); break;
+				}
+			}
+			writer.put('"');
+		}
+
+
+		/// Writes a collection in flow style (`[a, b]`, `{k: v}`), for the empty ones and the sequences nested in sequences
+		void writeFlow(const Node& node, Writer& writer) {
+			bool sequence = node.getKind() == Node::Kind::Sequence;
+			writer.put(sequence ? '[' : '{');
+			bool first = true;
+			for (const ChildList::Entry& entry : node.getChildren()) {
+				const Node& child = *entry.node;
+				if (!first)
+					writer.write(", ");
+				first = false;
+				if (!sequence) {
+					writeScalar(entry.key, Place::FlowKey, writer);
+					if (child.getKind() == Node::Kind::Scalar && child.getValue().empty())
+						continue;							// `{key}` has a null value
+					writer.write(": ");
+				}
+				if (child.getKind() == Node::Kind::Scalar)
+					writeScalar(child.getValue(), Place::Flow, writer);
+				else
+					writeFlow(child, writer);
+			}
+			writer.put(sequence ? ']' : '}');
+		}
+	}
+
+
+	void Yaml::emitEntry(std::string_view key, const Node& node, std::size_t indent, Writer& writer) {
+		writeScalar(key, Place::Key, writer);
+		writer.put(':');
+		if (node.getKind() == Node::Kind::Scalar) {
+			if (!node.getValue().empty()) {
+				writer.put(' ');
+				writeScalar(node.getValue(), Place::Value, writer);
+			}
+			writer.put('\n');
+			return;
+		}
+		if (node.getSize() == 0) {
+			writer.write(node.getKind() == Node::Kind::Sequence ? " []\n" : " {}\n");
+			return;
+		}
+		writer.put('\n');
+		emitChildren(node, indent + 2, writer);
+	}
+
+
+	void Yaml::emitChildren(const Node& node, std::size_t indent, Writer& writer) {
+		bool sequence = node.getKind() == Node::Kind::Sequence;
+		for (const ChildList::Entry& entry : node.getChildren()) {
+			const Node& child = *entry.node;
+			writer.indent(indent);
+			if (!sequence) {
+				emitEntry(entry.key, child, indent, writer);
+				continue;
+			}
+
+			/*Sequence item. The first key of a mapping item shares the line of the dash, the others are aligned on it.
+			Nested sequences and empty mappings have no block form on the line of the dash: they are written in flow style*/
+			writer.write("- ");
+			if (child.getKind() == Node::Kind::Scalar) {
+				writeScalar(child.getValue(), Place::Item, writer);
+				writer.put('\n');
+			}
+			else if (child.getKind() == Node::Kind::Mapping && child.getSize() != 0) {
+				bool first = true;
+				for (const ChildList::Entry& item : child.getChildren()) {
+					if (!first)
+						writer.indent(indent + 2);
+					emitEntry(item.key, *item.node, indent + 2, writer);
+					first = false;
+				}
+			}
+			else {
+				writeFlow(child, writer);
+				writer.put('\n');
+			}
+		}
+	}
+
+
+	void Yaml::save(Writer& writer) {
+		emitChildren(*this->m_roots, 0, writer);
+	}
+
+
+	bool Yaml::save(std::ostream& stream) {
+		Writer writer(stream);
+		save(writer);
+		return writer.flush();
+	}
+
+
+	bool Yaml::save(const std::string& filepath) {
+		std::ofstream file(filepath, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+		if (!file.is_open()) {
+			this->m_error = filepath + " cannot be written";
+			return false;
+		}
+		return save(file);
+	}
+}
@@ -0,0 +1,241 @@
+/**
+* Module: Tiny Yaml parser
+* Official Remote Repository: https://github.com/Mohido/Tiny_Yaml.git
+*
+* Push parser emitting events instead of building nodes, see EventParser in yaml.hpp.
+* The levels follow the same rules as Yaml::parseLine so both accept the same documents.
+*/
+#include "yaml.hpp"
+#include "scanner.hpp"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace TINY_YAML {
+
+	EventParser::EventParser(EventHandler& handler)
+	: m_handler(handler)
+	{}
+
+
+	bool EventParser::feed(std::string_view chunk) {
+		if (this->m_finished) {
+			this->m_error.clear();
+			this->m_finished = false;
+		}
+		if (!this->m_error.empty())
+			return false;
+
+		while (true) {
+			std::size_t eol = chunk.find('\n');
+			if (eol == std::string_view::npos) {
+				this->m_partial.append(chunk);
+				return true;
+			}
+			std::string_view lineContent = chunk.substr(0, eol);
+			chunk.remove_prefix(eol + 1);
+
+			/*Lines cut by the end of the previous chunk are completed in m_partial, the others are parsed in place*/
+			bool ok;
+			if (!this->m_partial.empty()) {
+				this->m_partial.append(lineContent);
+				ok = parseLine(this->m_partial);
+				this->m_partial.clear();
+			}
+			else
+				ok = parseLine(lineContent);
+			if (!ok)
+				return false;
+		}
+	}
+
+
+	bool EventParser::feed(std::istream& stream) {
+		/*The parser keeps cut lines itself, blocks are fed as they are read. A handler that gave up ends the reading*/
+		std::vector<char> block(TINY_YAML_READ_BLOCK_SIZE);
+		bool ok = true;
+		while (ok && stream && !this->m_handler.stopped()) {
+			stream.read(block.data(), static_cast<std::streamsize>(block.size()));
+			ok = feed(std::string_view(block.data(), static_cast<std::size_t>(stream.gcount())));
+		}
+		return ok;
+	}
+
+
+	bool EventParser::finish() {
+		if (this->m_finished)
+			this->m_error.clear();
+		bool ok = this->m_error.empty() && (this->m_partial.empty() || parseLine(this->m_partial));
+		if (ok) {
+			while (!this->m_levels.empty())
+				close();
+			if (!this->m_started)
+				this->m_handler.startMapping();
+			this->m_handler.end();
+		}
+
+		/*Ready for the next document, the error stays readable until then*/
+		this->m_partial.clear();
+		this->m_levels.clear();
+		this->m_started = false;
+		this->m_line = 0;
+		this->m_finished = true;
+		return ok;
+	}
+
+
+	bool EventParser::parseLine(std::string_view lineContent) {
+		this->m_line++;
+		if (lineContent.empty())
+			return true;
+
+		LineParts parts;
+		if (!splitLine(lineContent, parts))
+			return fail();
+		if (parts.firstChar == std::string_view::npos)		// Only white spaces or a comment
+			return true;
+		if (parts.colon == std::string_view::npos && parts.dash == std::string_view::npos)
+			return fail();
+
+		if (!this->m_started) {
+			this->m_handler.startMapping();
+			this->m_started = true;
+		}
+
+		/*Layer up. (Current line has less indentation than the open level = does not belong to it)*/
+		while (!this->m_levels.empty() && this->m_levels.back().indent >= parts.firstChar)
+			close();
+
+		/*List items*/
+		if (parts.dash != std::string_view::npos) {
+			while (!this->m_levels.empty() && this->m_levels.back().indent > parts.dash)
+				close();
+			if (!this->m_levels.empty() && this->m_levels.back().indent == parts.dash && this->m_levels.back().item)
+				close();
+			if (this->m_levels.empty() || !open(Node::Kind::Sequence))		// The document itself is a mapping
+				return fail();
+
+			/*`- [a, b]` or `- {a: 1}`, its colons are inside the collection*/
+			std::string_view item = lineContent.substr(parts.firstChar, parts.lastChar + 1 - parts.firstChar);
+			if (isFlow(item))
+				return parseFlow(item);
+			if (parts.colon == std::string_view::npos) {
+				this->m_handler.scalar(parts.key);
+				return true;
+			}
+			/*`- key: value` opens a mapping item, the key belongs to it*/
+			this->m_handler.startMapping();
+			this->m_levels.push_back({ parts.dash, true, Node::Kind::Mapping });
+		}
+
+		/*Key of the open mapping (or of the document)*/
+		if (!this->m_levels.empty() && !open(Node::Kind::Mapping))
+			return fail();
+		this->m_handler.key(parts.key);
+		if (parts.colon == parts.lastChar)
+			this->m_levels.push_back({ parts.firstChar, false, Node::Kind::Scalar });		// Its content (if any) comes on the next lines
+		else if (isFlow(parts.value))
+			return parseFlow(parts.value);
+		else
+			this->m_handler.scalar(parts.value);
+		return true;
+	}
+
+
+	bool EventParser::parseFlow(std::string_view text) {
+		/*Read as Yaml::parseFlow reads it: the collections still open are on the stack (true for a sequence)*/
+		std::vector<bool> open;
+		std::size_t pos = 0;
+		bool separated = true;										// A comma (or the opening bracket) came after the last entry
+		auto enter = [&]() {
+			bool sequence = text[pos++] == '[';
+			if (sequence)
+				this->m_handler.startSequence();
+			else
+				this->m_handler.startMapping();
+			open.push_back(sequence);
+			separated = true;
+		};
+
+		enter();
+		while (!open.empty()) {
+			skipFlowBlanks(text, pos);
+			if (pos >= text.size())
+				return fail();
+			bool sequence = open.back();
+
+			/*End of the collection (a trailing comma is allowed), or the comma after an entry*/
+			if (text[pos] == (sequence ? ']' : '}')) {
+				this->m_handler.end();
+				open.pop_back();
+				pos++;
+				separated = false;
+				continue;
+			}
+			if (!separated) {
+				if (text[pos] != ',')
+					return fail();
+				pos++;
+				separated = true;
+				continue;
+			}
+
+			/*Key of a mapping entry (`{a}` and `{a: }` have no value)*/
+			if (!sequence) {
+				std::string_view key;
+				if (!readFlowScalar(text, pos, ":,}", key) || key.empty())
+					return fail();
+				this->m_handler.key(key);
+				skipFlowBlanks(text, pos);
+				if (pos < text.size() && text[pos] == ':') {
+					pos++;
+					skipFlowBlanks(text, pos);
+				}
+			}
+
+			/*Value: a nested collection or a scalar*/
+			if (pos < text.size() && (text[pos] == '[' || text[pos] == '{')) {
+				enter();
+				continue;
+			}
+			std::string_view value;
+			if (!readFlowScalar(text, pos, sequence ? ",]" : ",}", value) || (sequence && value.empty()))
+				return fail();
+			this->m_handler.scalar(value);
+			separated = false;
+		}
+
+		/*Only blanks may follow the outer collection (the comment is already cut)*/
+		skipFlowBlanks(text, pos);
+		return pos == text.size() || fail();
+	}
+
+
+	bool EventParser::open(Node::Kind kind) {
+		Level& level = this->m_levels.back();
+		if (level.kind == Node::Kind::Scalar) {
+			level.kind = kind;
+			if (kind == Node::Kind::Mapping)
+				this->m_handler.startMapping();
+			else
+				this->m_handler.startSequence();
+		}
+		return level.kind == kind;
+	}
+
+
+	void EventParser::close() {
+		if (this->m_levels.back().kind == Node::Kind::Scalar)
+			this->m_handler.scalar(std::string_view());		// Key without any value
+		else
+			this->m_handler.end();
+		this->m_levels.pop_back();
+	}
+
+
+	bool EventParser::fail() {
+		this->m_error = "invalid yaml syntax at line: " + std::to_string(this->m_line);
+		return false;
+	}
+}
@@ -0,0 +1,270 @@
+/**
+* Module: Tiny Yaml parser
+* Official Remote Repository: https://github.com/Mohido/Tiny_Yaml.git
+*
+* JSON on both sides of the tree: JsonWriter transcodes parser events to JSON, Yaml::parseJson reads JSON into nodes.
+*/
+#include "yaml.hpp"
+
+#include <string>
+#include <vector>
+#include <charconv>
+#include <algorithm>
+#include <cmath>
+#include <cctype>
+
+namespace TINY_YAML {
+
+	namespace {
+		constexpr unsigned int JSON_MAX_DEPTH = 1024;									// Deeper documents are refused instead of exhausting the stack
+
+
+		void skipBlanks(std::string_view text, std::size_t& pos) {
+			while (pos < text.size() && (text[pos] == ' ' || text[pos] == '\t' || text[pos] == '\n' || text[pos] == '\r'))
+				pos++;
+		}
+
+
+		/// Reads a string starting at its quote, the result keeps the quotes
+		bool readString(std::string_view text, std::size_t& pos, std::string_view& result) {
+			std::size_t begin = pos++;
+			while (pos < text.size() && text[pos] != '"') {
+				if (text[pos] == '\\')
+					pos++;
+				else if (static_cast<unsigned char>(text[pos]) < 0x20)
+					return false;
+				pos++;
+			}
+			if (pos >= text.size())
+				return false;
+			result = text.substr(begin, ++pos - begin);
+			return true;
+		}
+
+
+		/// true, false, null or a number
+		bool isLiteral(std::string_view text) {
+			if (text == "true" || text == "false" || text == "null")
+				return true;
+			std::size_t pos = (!text.empty() && text[0] == '-') ? 1 : 0;
+			if (pos == text.size() || !std::isdigit(static_cast<unsigned char>(text[pos])))
+				return false;
+			double number;
+			auto [ptr, ec] = std::from_chars(text.data() + pos, text.data() + text.size(), number);
+			return ec == std::errc() && ptr == text.data() + text.size();
+		}
+	}
+
+
+	/////////////////////////////// JSON WRITER METHODS ///////////////////////////////
+	JsonWriter::JsonWriter(Writer& writer)
+	: m_writer(writer)
+	{}
+
+
+	void JsonWriter::separate() {
+		if (this->m_comma && !this->m_afterKey)
+			this->m_writer.put(',');
+		this->m_comma = true;
+		this->m_afterKey = false;
+	}
+
+
+	void JsonWriter::writeString(std::string_view text) {
+		static const char hex[] = "0123456789abcdef";
+		this->m_writer.put('"');
+		std::size_t plain = 0;
+		for (std::size_t i = 0; i < text.size(); i++) {
+			unsigned char c = static_cast<unsigned char>(text[i]);
+			if (c >= 0x20 && c != '"' && c != '\\')
+				continue;
+			this->m_writer.write(text.substr(plain, i - plain));
+			plain = i + 1;
+			switch (c) {
+			case '"': this->m_writer.write("\\\""); break;
+			case '\\': this->m_writer.write("\\\\"); break;
+			case '\n': this->m_writer.write("\\n"); break;
+			case '\r': this->m_writer.write("\\r"); break;
+			case '\t': this->m_writer.write("\\t"); break;
+			default:
+				this->m_writer.write("\\u00");
+				this->m_writer.put(hex[c >> 4]);
+				this->m_writer.put(hex[c & 15]);
+				break;
+			}
+		}
+		this->m_writer.write(text.substr(plain));
+		this->m_writer.put('"');
+	}
+
+
+	void JsonWriter::startMapping() {
+		separate();
+		this->m_writer.put('{');
+		this->m_closers.push_back('}');
+		this->m_comma = false;
+	}
+
+
+	void JsonWriter::startSequence() {
+		separate();
+		this->m_writer.put('[');
+		this->m_closers.push_back(']');
+		this->m_comma = false;
+	}
+
+
+	void JsonWriter::end() {
+		this->m_writer.put(this->m_closers.back());
+		this->m_closers.pop_back();
+		this->m_comma = true;
+	}
+
+
+	void JsonWriter::key(std::string_view key) {
+		separate();
+		writeString(Value::unquote(key, this->m_scratch));
+		this->m_writer.put(':');
+		this->m_afterKey = true;
+		this->m_scratch.rewind();
+	}
+
+
+	bool JsonWriter::stopped() const {
+		return !this->m_writer.good();
+	}
+
+
+	void JsonWriter::scalar(std::string_view value) {
+		separate();
+		Value resolved = Value::resolve(value, this->m_scratch);
+		char number[32];
+		switch (resolved.type()) {
+		case Value::Type::Null:
+			this->m_writer.write("null");
+			break;
+		case Value::Type::Bool:
+			this->m_writer.write(resolved.as<bool>() ? "true" : "false");
+			break;
+		case Value::Type::Int: {
+			auto result = std::to_chars(number, number + sizeof(number), resolved.as<std::int64_t>());
+			this->m_writer.write(std::string_view(number, result.ptr - number));
+			break;
+		}
+		case Value::Type::Double: {
+			double d = resolved.as<double>();
+			if (!std::isfinite(d))		// .inf and .nan are not JSON numbers
+				writeString(value);
+			else {
+				auto result = std::to_chars(number, number + sizeof(number), d);
+				this->m_writer.write(std::string_view(number, result.ptr - number));
+			}
+			break;
+		}
+		default:
+			writeString(resolved.as<std::string_view>());
+			break;
+		}
+		this->m_scratch.rewind();
+	}
+
+
+	bool JsonWriter::transcode(std::istream& yaml, std::ostream& json, std::string& error) {
+		Writer writer(json);
+		JsonWriter transcoder(writer);
+		EventParser parser(transcoder);
+		bool ok = parser.feed(yaml) && !transcoder.stopped() && parser.finish();
+		error = parser.getError();
+		return writer.flush() && ok;
+	}
+
+
+	/////////////////////////////// JSON INGEST ///////////////////////////////
+	bool Yaml::parseJson(std::string_view text, const LoadOptions& options) {
+		reset();
+		this->m_options = options;
+		this->m_copyText = false;
+
+		std::size_t pos = 0;
+		skipBlanks(text, pos);
+		bool valid = pos < text.size() && text[pos] == '{' && parseJsonValue(this->m_roots, text, pos, 0);
+		if (valid)
+			skipBlanks(text, pos);
+		if (!valid || pos != text.size()) {
+			pos = std::min(pos, text.size());
+			unsigned int line = 1 + static_cast<unsigned int>(std::count(text.data(), text.data() + pos, '\n'));
+			std::size_t lineStart = text.rfind('\n', pos == 0 ? 0 : pos - 1);
+			fail(ParseError::Code::InvalidJson, "invalid json syntax at line: " + std::to_string(line));
+			this->m_failure.line = line;
+			this->m_failure.column = static_cast<unsigned int>(pos - (lineStart == std::string_view::npos ? 0 : lineStart + 1)) + 1;
+			return false;
+		}
+		return true;
+	}
+
+
+	bool Yaml::parseJsonValue(Node* node, std::string_view text, std::size_t& pos, unsigned int depth) {
+		skipBlanks(text, pos);
+		if (pos >= text.size() || depth > JSON_MAX_DEPTH)
+			return false;
+
+		/*Objects and arrays decide the kind of the node even when they are empty*/
+		char open = text[pos];
+		if (open == '{' || open == '[') {
+			bool object = open == '{';
+			node->m_kind = object ? Node::Kind::Mapping : Node::Kind::Sequence;
+			pos++;
+			skipBlanks(text, pos);
+			if (pos < text.size() && text[pos] == (object ? '}' : ']')) {
+				pos++;
+				return true;
+			}
+			while (true) {
+				Node* child;
+				if (object) {
+					std::string_view key;
+					skipBlanks(text, pos);
+					if (pos >= text.size() || text[pos] != '"' || !readString(text, pos, key))
+						return false;
+					key = (key.find('\\') == std::string_view::npos) ? key.substr(1, key.size() - 2) : Value::resolve(key, *this->m_arena).as<std::string_view>();
+					skipBlanks(text, pos);
+					if (pos >= text.size() || text[pos++] != ':')
+						return false;
+					child = this->m_arena->create<Node>(key, std::string_view(), *this->m_arena);
+					if (!parseJsonValue(child, text, pos, depth + 1) || !node->append(child))		// Duplicated keys are refused, as in yaml
+						return false;
+				}
+				else {
+					child = this->m_arena->create<Node>(std::string_view(), std::string_view(), *this->m_arena);
+					if (!parseJsonValue(child, text, pos, depth + 1))
+						return false;
+					node->push(child);
+				}
+				skipBlanks(text, pos);
+				if (pos >= text.size())
+					return false;
+				char next = text[pos++];
+				if (next == (object ? '}' : ']'))
+					return true;
+				if (next != ',')
+					return false;
+			}
+		}
+
+		/*Scalars keep their text as written (strings with their quotes)*/
+		std::string_view value;
+		if (open == '"') {
+			if (!readString(text, pos, value))
+				return false;
+		}
+		else {
+			std::size_t end = text.find_first_of(",}] \t\r\n", pos);
+			value = text.substr(pos, (end == std::string_view::npos ? text.size() : end) - pos);
+			if (!isLiteral(value))
+				return false;
+			pos += value.size();
+		}
+		node->m_value = this->m_options.resolveScalars ? Value::resolve(value, *this->m_arena) : Value(value);
+		return true;
+	}
+}
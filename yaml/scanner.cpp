@@ -0,0 +1,422 @@
+/**
+* Module: Tiny Yaml parser
+* Official Remote Repository: https://github.com/Mohido/Tiny_Yaml.git
+*
+* Structural character scanner, see scanner.hpp.
+*/
+#include "scanner.hpp"
+
+#include <cstring>
+#include <algorithm>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+	#define TINY_YAML_X86 1
+	#include <immintrin.h>
+	#if defined(_MSC_VER) && !defined(__clang__)
+		#include <intrin.h>
+		#define TINY_YAML_TARGET_AVX2
+		#define TINY_YAML_TARGET_SSE2
+	#else
+		#define TINY_YAML_TARGET_AVX2 __attribute__((target("avx2")))
+		#define TINY_YAML_TARGET_SSE2 __attribute__((target("sse2")))
+	#endif
+#endif
+
+namespace TINY_YAML {
+
+	namespace {
+
+		/////////////////////////////// BIT HELPERS ///////////////////////////////
+		inline unsigned int lowestBit(std::uint64_t mask) {
+#if defined(_MSC_VER) && !defined(__clang__)
+			unsigned long index;
+			_BitScanForward64(&index, mask);
+			return static_cast<unsigned int>(index);
+#else
+			return static_cast<unsigned int>(__builtin_ctzll(mask));
+#endif
+		}
+
+
+		inline unsigned int highestBit(std::uint64_t mask) {
+#if defined(_MSC_VER) && !defined(__clang__)
+			unsigned long index;
+			_BitScanReverse64(&index, mask);
+			return static_cast<unsigned int>(index);
+#else
+			return 63 - static_cast<unsigned int>(__builtin_clzll(mask));
+#endif
+		}
+
+
+		/// Bits strictly above the given bit
+		inline std::uint64_t bitsAbove(unsigned int bit) {
+			return (bit == 63) ? 0 : (~std::uint64_t(0) << (bit + 1));
+		}
+
+
+		/// Bits strictly below the given bit
+		inline std::uint64_t bitsBelow(unsigned int bit) {
+			return (std::uint64_t(1) << bit) - 1;
+		}
+
+
+		/////////////////////////////// BLOCK CLASSIFIERS ///////////////////////////////
+		void scanBlockScalar(const char* block, BlockMasks& masks) {
+			masks = BlockMasks{};
+			for (unsigned int i = 0; i < 64; i++) {
+				std::uint64_t bit = std::uint64_t(1) << i;
+				switch (block[i])
+				{
+				case '-': masks.dash |= bit; break;
+				case '#': masks.hash |= bit; break;
+				case '\'': masks.singleQuote |= bit; break;
+				case '\"': masks.doubleQuote |= bit; break;
+				case ':': masks.colon |= bit; break;
+				case '\\': masks.backslash |= bit; break;
+				case ' ': case '\t': case '\n': case '\v': case '\f': case '\r': masks.space |= bit; break;
+				default: break;
+				}
+			}
+		}
+
+#ifdef TINY_YAML_X86
+		TINY_YAML_TARGET_SSE2 inline std::uint64_t bitsSSE2(__m128i eq, unsigned int shift) {
+			return static_cast<std::uint64_t>(static_cast<std::uint16_t>(_mm_movemask_epi8(eq))) << shift;
+		}
+
+
+		TINY_YAML_TARGET_AVX2 inline std::uint64_t bitsAVX2(__m256i eq, unsigned int shift) {
+			return static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(eq))) << shift;
+		}
+
+
+		TINY_YAML_TARGET_SSE2 void scanBlockSSE2(const char* block, BlockMasks& masks) {
+			masks = BlockMasks{};
+			for (unsigned int i = 0; i < 4; i++) {
+				__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 16 * i));
+				unsigned int shift = 16 * i;
+				/*'\t'..'\r' are 9..13: (c - 9) <= 4 as unsigned bytes*/
+				__m128i control = _mm_sub_epi8(v, _mm_set1_epi8(9));
+				__m128i space = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(_mm_min_epu8(control, _mm_set1_epi8(4)), control));
+
+				masks.dash |= bitsSSE2(_mm_cmpeq_epi8(v, _mm_set1_epi8('-')), shift);
+				masks.hash |= bitsSSE2(_mm_cmpeq_epi8(v, _mm_set1_epi8('#')), shift);
+				masks.singleQuote |= bitsSSE2(_mm_cmpeq_epi8(v, _mm_set1_epi8('\'')), shift);
+				masks.doubleQuote |= bitsSSE2(_mm_cmpeq_epi8(v, _mm_set1_epi8('\"')), shift);
+				masks.colon |= bitsSSE2(_mm_cmpeq_epi8(v, _mm_set1_epi8(':')), shift);
+				masks.backslash |= bitsSSE2(_mm_cmpeq_epi8(v, _mm_set1_epi8('\\')), shift);
+				masks.space |= bitsSSE2(space, shift);
+			}
+		}
+
+
+		TINY_YAML_TARGET_AVX2 void scanBlockAVX2(const char* block, BlockMasks& masks) {
+			masks = BlockMasks{};
+			for (unsigned int i = 0; i < 2; i++) {
+				__m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + 32 * i));
+				unsigned int shift = 32 * i;
+				/*'\t'..'\r' are 9..13: (c - 9) <= 4 as unsigned bytes*/
+				__m256i control = _mm256_sub_epi8(v, _mm256_set1_epi8(9));
+				__m256i space = _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')), _mm256_cmpeq_epi8(_mm256_min_epu8(control, _mm256_set1_epi8(4)), control));
+
+				masks.dash |= bitsAVX2(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('-')), shift);
+				masks.hash |= bitsAVX2(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('#')), shift);
+				masks.singleQuote |= bitsAVX2(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\'')), shift);
+				masks.doubleQuote |= bitsAVX2(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\"')), shift);
+				masks.colon |= bitsAVX2(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(':')), shift);
+				masks.backslash |= bitsAVX2(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\\')), shift);
+				masks.space |= bitsAVX2(space, shift);
+			}
+		}
+#endif
+
+		using BlockScanner = void (*)(const char*, BlockMasks&);
+
+		BlockScanner blockScanner(ScanLevel level) {
+#ifdef TINY_YAML_X86
+			if (level == ScanLevel::AVX2)
+				return scanBlockAVX2;
+			if (level == ScanLevel::SSE2)
+				return scanBlockSSE2;
+#endif
+			return scanBlockScalar;
+		}
+
+
+		/// Byte by byte scanLine() (the classifier the scanner replaced), for the builds and CPUs without SIMD: building the masks one byte at a time costs more than the bytes themselves
+		bool scanLineBytes(std::string_view line, LineMarks& marks) {
+			constexpr std::size_t npos = std::string_view::npos;
+			std::size_t hash = npos;
+			std::size_t fstQuote = npos;
+			std::size_t lstQuote = npos;
+			std::size_t dash = npos;
+			std::size_t colon = npos;
+			bool quoted = false;			// Inside a quoted span
+
+			/*The quotes, the comment, the dash and the colon need a state, the rest is found on the line cut at the comment*/
+			for (std::size_t i = 0; i < line.size(); i++) {
+				switch (line[i]) {
+				case '-':
+					if (dash == npos && !quoted)
+						dash = i;
+					break;
+				case ':':
+					if (colon == npos && !quoted)
+						colon = i;
+					break;
+				case '#':
+					if (!quoted)
+						hash = i;
+					break;
+				case '\'':
+				case '"':
+					if (i != 0 && line[i - 1] == '\\')
+						break;
+					if (!quoted) {
+						fstQuote = i;
+						lstQuote = npos;
+						quoted = true;
+					}
+					else if (line[fstQuote] == line[i]) {
+						lstQuote = i;
+						quoted = false;
+					}
+					break;
+				default:
+					break;
+				}
+				if (hash != npos)
+					break;
+			}
+			if (quoted) {
+				marks = LineMarks{ hash, fstQuote, lstQuote, dash, npos, npos, npos };
+				return false;
+			}
+
+			if (hash != npos)
+				line = line.substr(0, hash);
+			marks = LineMarks{ hash, fstQuote, lstQuote, dash, colon, line.find_first_not_of(" -#\t\f\v\n\r"), line.find_last_not_of(" #\t\f\v\n\r") };
+			return true;
+		}
+	}
+
+
+	ScanLevel detectScanLevel() {
+#if defined(TINY_YAML_X86) && defined(_MSC_VER) && !defined(__clang__)
+		int info[4];
+		__cpuid(info, 1);
+		bool sse2 = (info[3] & (1 << 26)) != 0;
+		bool osxsave = (info[2] & (1 << 27)) != 0;
+		bool avx = (info[2] & (1 << 28)) != 0;
+		__cpuidex(info, 7, 0);
+		bool avx2 = (info[1] & (1 << 5)) != 0;
+		if (avx2 && avx && osxsave && (_xgetbv(0) & 0x6) == 0x6)		// The OS must save the YMM registers
+			return ScanLevel::AVX2;
+		return sse2 ? ScanLevel::SSE2 : ScanLevel::Scalar;
+#elif defined(TINY_YAML_X86)
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx2"))
+			return ScanLevel::AVX2;
+		if (__builtin_cpu_supports("sse2"))
+			return ScanLevel::SSE2;
+		return ScanLevel::Scalar;
+#else
+		return ScanLevel::Scalar;
+#endif
+	}
+
+
+	void scanBlock(const char* block, BlockMasks& masks, ScanLevel level) {
+		blockScanner(level)(block, masks);
+	}
+
+
+	bool scanLine(std::string_view line, LineMarks& marks) {
+		static const ScanLevel level = detectScanLevel();
+		return scanLine(line, marks, level);
+	}
+
+
+	bool scanLine(std::string_view line, LineMarks& marks, ScanLevel level) {
+		constexpr std::size_t npos = std::string_view::npos;
+		if (level == ScanLevel::Scalar)
+			return scanLineBytes(line, marks);
+		BlockScanner scan = blockScanner(level);
+		marks = LineMarks{ npos, npos, npos, npos, npos, npos, npos };
+
+		/*0: outside of the quotes, 1: inside the quotes, 3: comment found*/
+		int phase = 0;
+		bool singleQuoted = false;			// Kind of the opening quote
+		std::uint64_t prevBackslash = 0;	// Last byte of the previous block was a '\\'
+		std::size_t firstChar = npos;
+		char tail[64];
+
+		for (std::size_t offset = 0; offset < line.size(); offset += 64) {
+			/*The last partial block is padded with zeros which are not textmarks*/
+			std::size_t length = line.size() - offset;
+			const char* block = line.data() + offset;
+			std::uint64_t valid = ~std::uint64_t(0);
+			if (length < 64) {
+				std::memset(tail, 0, sizeof(tail));
+				std::memcpy(tail, block, length);
+				block = tail;
+				valid = bitsBelow(static_cast<unsigned int>(length));
+			}
+
+			BlockMasks masks;
+			scan(block, masks);
+
+			/*Quotes right after a '\\' are escaped*/
+			std::uint64_t escaped = (masks.backslash << 1) | prevBackslash;
+			prevBackslash = masks.backslash >> 63;
+			std::uint64_t single = masks.singleQuote & ~escaped & valid;
+			std::uint64_t dbl = masks.doubleQuote & ~escaped & valid;
+			std::uint64_t hash = masks.hash & valid;
+
+			/*Walk the quote/comment events of the block in order*/
+			std::uint64_t outside = valid;							// Bytes not inside the quotes
+			std::uint64_t beforeHash = (phase == 3) ? 0 : valid;	// Bytes before the comment
+			std::uint64_t cursor = valid;							// Bytes not walked yet
+			while (phase != 3) {
+				if (phase == 0) {
+					std::uint64_t events = (single | dbl | hash) & cursor;
+					if (events == 0)
+						break;
+					unsigned int bit = lowestBit(events);
+					if (hash & (std::uint64_t(1) << bit)) {
+						marks.hash = offset + bit;
+						beforeHash &= bitsBelow(bit);
+						phase = 3;
+						break;
+					}
+					marks.fstQuote = offset + bit;
+					marks.lstQuote = npos;
+					singleQuoted = (single & (std::uint64_t(1) << bit)) != 0;
+					cursor &= bitsAbove(bit);
+					phase = 1;
+				}
+				else if (phase == 1) {
+					std::uint64_t events = (singleQuoted ? single : dbl) & cursor;
+					if (events == 0) {
+						outside &= ~cursor;
+						break;
+					}
+					unsigned int bit = lowestBit(events);
+					outside &= ~(cursor & bitsBelow(bit));
+					marks.lstQuote = offset + bit;
+					cursor &= bitsAbove(bit);
+					phase = 0;			// Later quotes open new spans (e.g. `["a#", "b#"]`)
+				}
+			}
+
+			/*First/last positions of the block*/
+			std::uint64_t dash = masks.dash & outside & beforeHash;
+			if (marks.dash == npos && dash != 0)
+				marks.dash = offset + lowestBit(dash);
+			std::uint64_t colon = masks.colon & outside & beforeHash;
+			if (marks.colon == npos && colon != 0)
+				marks.colon = offset + lowestBit(colon);
+			std::uint64_t first = ~(masks.space | masks.dash | masks.hash) & valid;
+			if (firstChar == npos && first != 0)
+				firstChar = offset + lowestBit(first);
+			std::uint64_t last = ~(masks.space | masks.hash) & beforeHash;
+			if (last != 0)
+				marks.lastChar = offset + highestBit(last);
+
+			/*Nothing after the comment counts*/
+			if (phase == 3)
+				break;
+		}
+
+		if (phase == 1)
+			return false;
+
+		/*The first character only counts before the comment*/
+		if (firstChar < marks.hash)
+			marks.firstChar = firstChar;
+		return true;
+	}
+
+
+	bool splitLine(std::string_view line, LineParts& parts) {
+		constexpr std::size_t npos = std::string_view::npos;
+		LineMarks marks;
+		if (!scanLine(line, marks)) {
+			parts.firstChar = marks.fstQuote;
+			return false;
+		}
+		if (marks.hash != npos)
+			line = line.substr(0, marks.hash);
+
+		parts.dash = marks.dash;
+		parts.colon = marks.colon;
+		parts.firstChar = marks.firstChar;
+		parts.lastChar = marks.lastChar;
+		parts.key = std::string_view();
+		parts.value = std::string_view();
+
+		/*A dash is a list mark only when it starts the line and is followed by a blank, otherwise it is text (e.g. `value: -42`)*/
+		if (parts.dash != npos) {
+			std::size_t indentPos = line.find_first_not_of(" \t");
+			bool blankAfter = parts.dash + 1 >= line.size() || line[parts.dash + 1] == ' ' || line[parts.dash + 1] == '\t';
+			if (parts.dash == indentPos && blankAfter)
+				parts.firstChar = line.find_first_not_of(" \t\f\v\n\r", parts.dash + 1);
+			else {
+				parts.dash = npos;
+				parts.firstChar = indentPos;
+			}
+			if (parts.firstChar > parts.lastChar)
+				parts.firstChar = npos;
+		}
+		if (parts.firstChar == npos)
+			return true;
+
+		/*The key (or item) ends at the colon, the value starts after it*/
+		std::size_t keyEnd = (parts.colon <= parts.lastChar) ? parts.colon : parts.lastChar + 1;
+		parts.key = line.substr(parts.firstChar, keyEnd - parts.firstChar);
+		if (parts.colon < parts.lastChar && parts.lastChar != npos) {
+			parts.value = line.substr(parts.colon + 1, parts.lastChar - parts.colon);
+			parts.value.remove_prefix(std::min(parts.value.size(), parts.value.find_first_not_of(" \t\f\v\n\r")));
+		}
+		return true;
+	}
+
+
+	bool isFlow(std::string_view text) {
+		return !text.empty() && (text[0] == '[' || text[0] == '{');
+	}
+
+
+	void skipFlowBlanks(std::string_view text, std::size_t& pos) {
+		while (pos < text.size() && (text[pos] == ' ' || text[pos] == '\t' || text[pos] == '\r'))
+			pos++;
+	}
+
+
+	bool readFlowScalar(std::string_view text, std::size_t& pos, const char* stops, std::string_view& result) {
+		std::size_t begin = pos;
+		char quote = (pos < text.size()) ? text[pos] : '\0';
+		if (quote == '"' || quote == '\'') {
+			for (pos++; pos < text.size(); pos++) {
+				if (quote == '"' && text[pos] == '\\')
+					pos++;										// Escaped character
+				else if (text[pos] == quote && (quote == '"' || pos + 1 >= text.size() || text[pos + 1] != '\''))
+					break;
+				else if (text[pos] == quote)
+					pos++;										// '' inside single quotes
+			}
+			if (pos >= text.size())
+				return false;
+			result = text.substr(begin, ++pos - begin);
+			skipFlowBlanks(text, pos);
+			return pos == text.size() || std::strchr(stops, text[pos]) != nullptr;
+		}
+		pos = std::min(text.find_first_of(stops, pos), text.size());
+		std::size_t end = pos;
+		while (end > begin && (text[end - 1] == ' ' || text[end - 1] == '\t' || text[end - 1] == '\r'))
+			end--;
+		result = text.substr(begin, end - begin);
+		return true;
+	}
+}
@@ -0,0 +1,121 @@
+/**
+* Module: Tiny Yaml parser
+* Official Remote Repository: https://github.com/Mohido/Tiny_Yaml.git
+*
+* Structural character scanner used by the line parser.
+* A line is classified 64 bytes at a time: every block is turned into bitmasks (one bit per byte) of the characters
+* the parser cares about, using AVX2 or SSE2 when the CPU has them (picked once at runtime) and plain C++ otherwise.
+* The quoted spans, the comment and the first/last meaningful characters are then resolved from the bitmasks with bit tricks,
+* instead of testing every byte in a switch and running extra find() passes over the line.
+*/
+#pragma once
+
+#ifndef TINY_YAML_SCANNER
+#define TINY_YAML_SCANNER
+
+#include <cstdint>
+#include <string_view>
+
+namespace TINY_YAML {
+
+	/// <summary>
+	/// Instruction set used to build the block bitmasks.
+	/// </summary>
+	enum class ScanLevel {
+		Scalar,																			// No bitmasks: scanLine() walks the line byte by byte
+		SSE2,
+		AVX2
+	};
+
+
+	/// <summary>
+	/// Bitmasks of a 64 bytes block. Bit i describes byte i of the block.
+	/// </summary>
+	struct BlockMasks {
+		std::uint64_t dash;																// '-'
+		std::uint64_t hash;																// '#'
+		std::uint64_t singleQuote;														// '\''
+		std::uint64_t doubleQuote;														// '"'
+		std::uint64_t colon;															// ':'
+		std::uint64_t backslash;														// '\\'
+		std::uint64_t space;															// ' ', '\t', '\n', '\v', '\f', '\r'
+	};
+
+
+	/// <summary>
+	/// Positions (std::string_view::npos if missing) of the yaml textmarks of one line, as the parser consumes them.
+	/// </summary>
+	struct LineMarks {
+		std::size_t hash;																// Comment start (outside of the quotes)
+		std::size_t fstQuote;															// Opening quote of the last quoted span
+		std::size_t lstQuote;															// Closing quote of that span (npos while it is not closed)
+		std::size_t dash;																// First dash outside of the quotes, before the comment
+		std::size_t colon;																// First colon outside of the quotes, before the comment
+		std::size_t firstChar;															// First character that is not a space, dash or hash (before the comment)
+		std::size_t lastChar;															// Last character that is not a space or hash (before the comment)
+	};
+
+
+	/// <summary>
+	/// Meaning of one line, as the parsers consume it. Positions are std::string_view::npos if missing.
+	/// </summary>
+	struct LineParts {
+		std::size_t dash;																// Column of the list mark, npos if the line is not a `- ` item
+		std::size_t colon;																// First colon outside of the quotes, before the comment
+		std::size_t firstChar;															// Column of the key (or of the item after the dash), npos if the line is blank
+		std::size_t lastChar;															// Last meaningful character
+		std::string_view key;															// Key, or the whole text of a `- item` line
+		std::string_view value;															// Text after the colon, empty if there is none
+	};
+
+
+	/// <summary>
+	/// </summary>
+	/// <returns>Best instruction set supported by the running CPU</returns>
+	ScanLevel detectScanLevel();
+
+	/// <summary>
+	/// Builds the bitmasks of 64 bytes using the given instruction set (which must be supported by the CPU).
+	/// </summary>
+	void scanBlock(const char* block, BlockMasks& masks, ScanLevel level);
+
+	/// <summary>
+	/// Finds the yaml textmarks of a line.
+	/// </summary>
+	/// <param name="line">Line without its '\n'</param>
+	/// <param name="marks">Resulting positions</param>
+	/// <param name="level">Instruction set, detectScanLevel() by default</param>
+	/// <returns>False if a quote is opened and never closed</returns>
+	bool scanLine(std::string_view line, LineMarks& marks, ScanLevel level);
+	bool scanLine(std::string_view line, LineMarks& marks);
+
+	/// <summary>
+	/// Scans a line and splits it into its key, value and list mark. The comment is dropped.
+	/// </summary>
+	/// <param name="line">Line without its '\n'</param>
+	/// <param name="parts">Views into the line</param>
+	/// <returns>False if a quote is opened and never closed (parts.firstChar is then the column of that quote)</returns>
+	bool splitLine(std::string_view line, LineParts& parts);
+
+	/// <summary>
+	/// </summary>
+	/// <returns>True if the value (or the item) is a flow collection: `[a, b]` or `{a: 1}`</returns>
+	bool isFlow(std::string_view text);
+
+	/// <summary>
+	/// Moves pos past the blanks between the tokens of a flow collection.
+	/// </summary>
+	void skipFlowBlanks(std::string_view text, std::size_t& pos);
+
+	/// <summary>
+	/// Reads a scalar of a flow collection up to one of the stops. Quoted scalars keep their quotes, plain ones lose their blanks.
+	/// </summary>
+	/// <param name="text">Flow collection</param>
+	/// <param name="pos">Start of the scalar, moved to the stop that ends it</param>
+	/// <param name="stops">Characters ending a plain scalar (and the only ones allowed after a quoted one)</param>
+	/// <param name="result">View of the scalar</param>
+	/// <returns>False if a quoted scalar is not closed or is followed by something else than a stop</returns>
+	bool readFlowScalar(std::string_view text, std::size_t& pos, const char* stops, std::string_view& result);
+}
+
+#endif
@@ -0,0 +1,57 @@
+/**
+* Module: Tiny Yaml parser
+* Official Remote Repository: https://github.com/Mohido/Tiny_Yaml.git
+*
+* Load statistics: merging the stats of the workers, reading them from a Yaml object and writing them as a trace.
+*/
+#include "yaml.hpp"
+
+#include <algorithm>
+
+namespace TINY_YAML {
+
+	/////////////////////////////// LOAD STATS METHODS ///////////////////////////////
+	void LoadStats::merge(const LoadStats& other) {
+		this->bytesRead += other.bytesRead;
+		this->lines += other.lines;
+		this->nodes += other.nodes;
+		this->allocations += other.allocations;
+		this->bytesAllocated += other.bytesAllocated;
+		this->maxDepth = std::max(this->maxDepth, other.maxDepth);
+		this->readSeconds += other.readSeconds;
+		this->scanSeconds += other.scanSeconds;
+		this->buildSeconds += other.buildSeconds;
+		this->events.insert(this->events.end(), other.events.begin(), other.events.end());
+	}
+
+
+	void LoadStats::writeTrace(std::ostream& stream) const {
+		stream << "{\"traceEvents\":[";
+		for (std::size_t i = 0; i < this->events.size(); i++) {
+			const Event& event = this->events[i];
+			stream << (i == 0 ? "" : ",") << "\n{\"name\":\"" << event.name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << event.thread
+				<< ",\"ts\":" << event.start << ",\"dur\":" << event.duration;
+			if (std::string_view(event.name) == "load") {
+				stream << ",\"args\":{\"bytesRead\":" << this->bytesRead << ",\"lines\":" << this->lines << ",\"nodes\":" << this->nodes
+					<< ",\"allocations\":" << this->allocations << ",\"bytesAllocated\":" << this->bytesAllocated << ",\"bytesReserved\":" << this->bytesReserved
+					<< ",\"maxDepth\":" << this->maxDepth << ",\"readSeconds\":" << this->readSeconds << ",\"scanSeconds\":" << this->scanSeconds
+					<< ",\"buildSeconds\":" << this->buildSeconds << "}";
+			}
+			stream << "}";
+		}
+		stream << "\n]}\n";
+	}
+
+
+	/////////////////////////////// YAML STATS ///////////////////////////////
+	LoadStats Yaml::getStats() const {
+		std::lock_guard<std::mutex> lock(this->m_lazyMutex);		// Lazy parses add to the stats
+		LoadStats stats = this->m_stats;
+#if TINY_YAML_STATS
+		stats.bytesReserved = this->m_arena->reserved();
+		for (const auto& arena : this->m_chunkArenas)
+			stats.bytesReserved += arena->reserved();
+#endif
+		return stats;
+	}
+}
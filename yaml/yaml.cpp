@@ -20,7 +20,7 @@
 *
 * Notes:
 *	- All values are stored as strings. The developer will have to go through changing a string to number if needed. (e.g: if value is 123, it is stored as string)
-*	- At the moment there is no save into file function since it is using the std::unordered_map for storing the children nodes.
+*	- Yaml::save writes the tree back in block style.
 *	- This is a light-weight library, meaning that it will not handle exceptions and missuse of data. For instance, accessing a node that does not exist will not be handled by the library.
 *
 *
@@ -70,6 +70,7 @@
 *		coolYamlObject["node_list"]["1"]["extra"].getData<std::vector<std::string>>()[2];
 */
 #include "yaml.hpp"
+#include "scanner.hpp"
 
 #include <vector>
 #include <tuple>
@@ -78,245 +79,1704 @@
 #include <memory>
 #include <stack>
 #include <fstream>
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+#include <charconv>
+#include <cmath>
+#include <limits>
+#include <atomic>
+#include <thread>
+#include <system_error>
+#include <new>
+#include <functional>
+
+#if _WIN32
+	#define WIN32_LEAN_AND_MEAN
+	#define NOMINMAX
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
 
 namespace TINY_YAML {
 
+	/*Stats hooks. Every load makes its LoadStats current on its thread (workers get their own, merged after the join); with TINY_YAML_STATS=0 the hooks are empty*/
+#if TINY_YAML_STATS
+	namespace {
+		thread_local LoadStats* t_stats = nullptr;										// Stats of the load running on this thread
 
-	/////////////////////////////// NODE CLASS METHODS ///////////////////////////////
-	Node::Node(const std::string& identifier, std::shared_ptr<void> data)
-	: m_identifier(identifier), m_data(data)
+
+		/// Adds the time spent in its scope to a field of the current stats
+		class ScopeTimer {
+		private:
+			double LoadStats::* m_field;
+			std::chrono::steady_clock::time_point m_start;
+
+		public:
+			explicit ScopeTimer(double LoadStats::* field)
+			: m_field(field)
+			{
+				if (t_stats != nullptr)
+					this->m_start = std::chrono::steady_clock::now();
+			}
+
+			~ScopeTimer() {
+				if (t_stats != nullptr)
+					t_stats->*this->m_field += std::chrono::duration<double>(std::chrono::steady_clock::now() - this->m_start).count();
+			}
+
+			/// Ends the current phase, the rest of the scope goes to the next field
+			void split(double LoadStats::* next) {
+				if (t_stats == nullptr)
+					return;
+				auto now = std::chrono::steady_clock::now();
+				t_stats->*this->m_field += std::chrono::duration<double>(now - this->m_start).count();
+				this->m_field = next;
+				this->m_start = now;
+			}
+		};
+
+
+		/// Makes the stats current on this thread for its scope and records the span as an event
+		class StatsScope {
+		private:
+			LoadStats* m_previous;
+			LoadStats& m_stats;
+			std::chrono::steady_clock::time_point m_epoch;
+			std::chrono::steady_clock::time_point m_start;
+			const char* m_name;
+			std::uint32_t m_thread;
+			bool m_load;
+
+		public:
+			/// A load scope starts the epoch, the others are placed relative to it
+			StatsScope(LoadStats& stats, std::chrono::steady_clock::time_point& epoch, const char* name, std::uint32_t thread, bool load)
+			: m_previous(t_stats), m_stats(stats), m_start(std::chrono::steady_clock::now()), m_name(name), m_thread(thread), m_load(load)
+			{
+				if (load)
+					epoch = this->m_start;
+				this->m_epoch = epoch;
+				t_stats = &stats;
+			}
+
+			~StatsScope() {
+				auto end = std::chrono::steady_clock::now();
+				double duration = std::chrono::duration<double, std::micro>(end - this->m_start).count();
+				this->m_stats.events.push_back({ this->m_name, this->m_thread, std::chrono::duration<double, std::micro>(this->m_start - this->m_epoch).count(), duration });
+				if (this->m_load)
+					this->m_stats.totalSeconds += duration / 1e6;
+				t_stats = this->m_previous;
+			}
+		};
+	}
+
+	#define TINY_YAML_STATS_COUNT(field, n) do { if (t_stats != nullptr) t_stats->field += (n); } while (0)
+	#define TINY_YAML_STATS_MAX(field, n) do { if (t_stats != nullptr && t_stats->field < (n)) t_stats->field = static_cast<std::uint32_t>(n); } while (0)
+	#define TINY_YAML_STATS_TIME(field) ScopeTimer timer_##field(&LoadStats::field)
+	#define TINY_YAML_STATS_SPLIT(field, next) timer_##field.split(&LoadStats::next)
+	#define TINY_YAML_STATS_LOAD(yaml) StatsScope statsScope((yaml).m_stats, (yaml).m_statsEpoch, "load", 0, true)
+	#define TINY_YAML_STATS_SCOPE(stats, epoch, name, thread) StatsScope statsScope(stats, epoch, name, thread, false)
+#else
+	#define TINY_YAML_STATS_COUNT(field, n) do {} while (0)
+	#define TINY_YAML_STATS_MAX(field, n) do {} while (0)
+	#define TINY_YAML_STATS_TIME(field) do {} while (0)
+	#define TINY_YAML_STATS_SPLIT(field, next) do {} while (0)
+	#define TINY_YAML_STATS_LOAD(yaml) do {} while (0)
+	#define TINY_YAML_STATS_SCOPE(stats, epoch, name, thread) do {} while (0)
+#endif
+
+
+	/////////////////////////////// MAPPED FILE METHODS ///////////////////////////////
+	MappedFile::~MappedFile() {
+		close();
+	}
+
+
+	bool MappedFile::open(const std::string& filepath) {
+		close();
+#if _WIN32
+		HANDLE file = CreateFileA(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+			return false;
+		this->m_file = file;
+
+		LARGE_INTEGER size;
+		if (!GetFileSizeEx(file, &size)) {
+			close();
+			return false;
+		}
+		if (size.QuadPart == 0)			// Empty files can not be mapped, they are simply empty documents.
+			return true;
+
+		this->m_mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (this->m_mapping == nullptr) {
+			close();
+			return false;
+		}
+		this->m_data = static_cast<const char*>(MapViewOfFile(this->m_mapping, FILE_MAP_READ, 0, 0, 0));
+		if (this->m_data == nullptr) {
+			close();
+			return false;
+		}
+		this->m_size = static_cast<std::size_t>(size.QuadPart);
+#else
+		int fd = ::open(filepath.c_str(), O_RDONLY);
+		if (fd < 0)
+			return false;
+
+		struct stat st;
+		if (fstat(fd, &st) != 0) {
+			::close(fd);
+			return false;
+		}
+		if (st.st_size == 0) {			// Empty files can not be mapped, they are simply empty documents.
+			::close(fd);
+			return true;
+		}
+
+		void* data = mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+		::close(fd);					// The mapping keeps its own reference to the file
+		if (data == MAP_FAILED)
+			return false;
+		madvise(data, static_cast<std::size_t>(st.st_size), MADV_SEQUENTIAL);
+
+		this->m_data = static_cast<const char*>(data);
+		this->m_size = static_cast<std::size_t>(st.st_size);
+#endif
+		return true;
+	}
+
+
+	void MappedFile::close() {
+#if _WIN32
+		if (this->m_data != nullptr)
+			UnmapViewOfFile(this->m_data);
+		if (this->m_mapping != nullptr)
+			CloseHandle(this->m_mapping);
+		if (this->m_file != nullptr)
+			CloseHandle(this->m_file);
+		this->m_mapping = nullptr;
+		this->m_file = nullptr;
+#else
+		if (this->m_data != nullptr)
+			munmap(const_cast<char*>(this->m_data), this->m_size);
+#endif
+		this->m_data = nullptr;
+		this->m_size = 0;
+	}
+
+
+	/////////////////////////////// LINE READER METHODS ///////////////////////////////
+	LineReader::LineReader(std::istream& stream, std::size_t blockSize)
+	: m_stream(stream), m_buffer(std::max<std::size_t>(blockSize, 1))
 	{}
 
-	
-	Node::~Node() {
-		m_children.clear();
+
+	bool LineReader::fill() {
+		/*Move the unfinished line to the front, grow the buffer only if the line fills all of it*/
+		if (this->m_begin != 0) {
+			std::memmove(this->m_buffer.data(), this->m_buffer.data() + this->m_begin, this->m_end - this->m_begin);
+			this->m_end -= this->m_begin;
+			this->m_begin = 0;
+		}
+		if (this->m_end == this->m_buffer.size())
+			this->m_buffer.resize(this->m_buffer.size() * 2);
+
+		TINY_YAML_STATS_TIME(readSeconds);
+		this->m_stream.read(this->m_buffer.data() + this->m_end, this->m_buffer.size() - this->m_end);
+		std::size_t count = static_cast<std::size_t>(this->m_stream.gcount());
+		TINY_YAML_STATS_COUNT(bytesRead, count);
+		this->m_end += count;
+		if (count == 0)
+			this->m_eof = true;
+		return count != 0;
 	}
+
+
+	bool LineReader::next(std::string_view& line) {
+		while (true) {
+			const char* begin = this->m_buffer.data() + this->m_begin;
+			const char* eol = static_cast<const char*>(std::memchr(begin + this->m_scanned, '\n', this->m_end - this->m_begin - this->m_scanned));
+			if (eol != nullptr) {
+				line = std::string_view(begin, eol - begin);
+				this->m_begin += line.size() + 1;
+				this->m_scanned = 0;
+				return true;
+			}
+			this->m_scanned = this->m_end - this->m_begin;
+			if (this->m_eof || !fill()) {
+				/*Last line without a trailing '\n'*/
+				if (this->m_begin == this->m_end)
+					return false;
+				line = std::string_view(this->m_buffer.data() + this->m_begin, this->m_end - this->m_begin);
+				this->m_begin = this->m_end;
+				this->m_scanned = 0;
+				return true;
+			}
+		}
+	}
+
+
+	/////////////////////////////// ARENA METHODS ///////////////////////////////
+	Arena::~Arena() {
+		clear();
+	}
+
+
+	namespace {
+		/// Orders an address before the ranges that start after it
+		struct RangeStart {
+			template<typename Range> bool operator()(const char* address, const Range& range) const {
+				return std::less<const char*>()(address, range.begin);
+			}
+		};
+	}
+
+
+	void* Arena::do_allocate(std::size_t bytes, std::size_t alignment) {
+		TINY_YAML_STATS_COUNT(allocations, 1);
+		TINY_YAML_STATS_COUNT(bytesAllocated, bytes);
+		std::size_t padding = (alignment - reinterpret_cast<std::uintptr_t>(this->m_cursor) % alignment) % alignment;
+		if (this->m_cursor == nullptr || padding + bytes > static_cast<std::size_t>(this->m_end - this->m_cursor)) {
+			/*Open a new block, big requests get a block of their own size*/
+			std::size_t size = std::max(this->m_nextBlockSize, bytes + alignment);
+			this->m_blocks.push_back({ std::unique_ptr<char[]>(new char[size]), size });
+			this->m_cursor = this->m_blocks.back().data.get();
+			this->m_end = this->m_cursor + size;
+			this->m_ranges.insert(std::upper_bound(this->m_ranges.begin(), this->m_ranges.end(), this->m_cursor, RangeStart()), { this->m_cursor, this->m_end });
+			this->m_reserved += size;
+			this->m_nextBlockSize = std::min<std::size_t>(this->m_nextBlockSize * 2, 4 * 1024 * 1024);
+			padding = (alignment - reinterpret_cast<std::uintptr_t>(this->m_cursor) % alignment) % alignment;
+		}
+		void* result = this->m_cursor + padding;
+		this->m_cursor += padding + bytes;
+		return result;
+	}
+
+
+	std::string_view Arena::store(std::string_view text) {
+		if (text.empty())
+			return std::string_view();
+		char* copy = static_cast<char*>(allocate(text.size(), 1));
+		std::memcpy(copy, text.data(), text.size());
+		return std::string_view(copy, text.size());
+	}
+
+
+	void Arena::clear() {
+		for (auto it = this->m_cleanups.rbegin(); it != this->m_cleanups.rend(); it++)
+			it->destroy(it->object);
+		this->m_cleanups.clear();
+		this->m_blocks.clear();
+		this->m_ranges.clear();
+		this->m_cursor = nullptr;
+		this->m_end = nullptr;
+		this->m_nextBlockSize = 64 * 1024;
+		this->m_reserved = 0;
+	}
+
+
+	void Arena::rewind() {
+		for (auto it = this->m_cleanups.rbegin(); it != this->m_cleanups.rend(); it++)
+			it->destroy(it->object);
+		this->m_cleanups.clear();
+		if (this->m_blocks.empty())
+			return;
+
+		/*The current block is the last (and usually the biggest) one*/
+		std::swap(this->m_blocks.front(), this->m_blocks.back());
+		this->m_blocks.resize(1);
+		this->m_cursor = this->m_blocks.front().data.get();
+		this->m_end = this->m_cursor + this->m_blocks.front().size;
+		this->m_reserved = this->m_blocks.front().size;
+		this->m_ranges.assign(1, { this->m_cursor, this->m_end });
+	}
+
+
+	bool Arena::contains(const void* address) const {
+		const char* byte = static_cast<const char*>(address);
+		auto after = std::upper_bound(this->m_ranges.begin(), this->m_ranges.end(), byte, RangeStart());
+		return after != this->m_ranges.begin() && std::less<const char*>()(byte, (after - 1)->end);
+	}
+
+
+	/////////////////////////////// VALUE METHODS ///////////////////////////////
+	namespace {
+
+		bool parseNull(std::string_view text) {
+			return text.empty() || text == "~" || text == "null" || text == "Null" || text == "NULL";
+		}
+
+
+		bool parseBool(std::string_view text, bool& result) {
+			if (text == "true" || text == "True" || text == "TRUE") {
+				result = true;
+				return true;
+			}
+			if (text == "false" || text == "False" || text == "FALSE") {
+				result = false;
+				return true;
+			}
+			return false;
+		}
+
+
+		bool parseInt(std::string_view text, std::int64_t& result) {
+			bool negative = false;
+			if (!text.empty() && (text[0] == '-' || text[0] == '+')) {
+				negative = text[0] == '-';
+				text.remove_prefix(1);
+			}
+			int base = 10;
+			if (text.size() > 2 && text[0] == '0' && (text[1] == 'x' || text[1] == 'o')) {
+				base = (text[1] == 'x') ? 16 : 8;
+				text.remove_prefix(2);
+			}
+			if (text.empty() || text[0] == '-' || text[0] == '+')
+				return false;
+
+			/*Parse the magnitude unsigned so INT64_MIN fits*/
+			std::uint64_t magnitude = 0;
+			auto end = text.data() + text.size();
+			auto [ptr, ec] = std::from_chars(text.data(), end, magnitude, base);
+			if (ec != std::errc() || ptr != end)
+				return false;
+			if (magnitude > static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max()) + (negative ? 1 : 0))
+				return false;
+			result = negative ? static_cast<std::int64_t>(0 - magnitude) : static_cast<std::int64_t>(magnitude);
+			return true;
+		}
+
+
+		bool parseDouble(std::string_view text, double& result) {
+			bool negative = false;
+			if (!text.empty() && (text[0] == '-' || text[0] == '+')) {
+				negative = text[0] == '-';
+				text.remove_prefix(1);
+			}
+			if (text == ".inf" || text == ".Inf" || text == ".INF") {
+				result = negative ? -std::numeric_limits<double>::infinity() : std::numeric_limits<double>::infinity();
+				return true;
+			}
+			if (text == ".nan" || text == ".NaN" || text == ".NAN") {
+				result = std::numeric_limits<double>::quiet_NaN();
+				return true;
+			}
+			/*from_chars also takes "inf"/"nan" which are plain strings in yaml*/
+			if (text.empty() || !(std::isdigit(static_cast<unsigned char>(text[0])) || text[0] == '.'))
+				return false;
+			auto end = text.data() + text.size();
+			auto [ptr, ec] = std::from_chars(text.data(), end, result);
+			if (ec != std::errc() || ptr != end)
+				return false;
+			result = negative ? -result : result;
+			return true;
+		}
+
+
+		/// Reads the 4 hexadecimal digits of a \u escape
+		bool readHex4(std::string_view text, std::size_t pos, unsigned int& code) {
+			if (pos + 4 > text.size())
+				return false;
+			code = 0;
+			for (std::size_t i = pos; i < pos + 4; i++) {
+				char c = text[i];
+				unsigned int digit = (c >= '0' && c <= '9') ? c - '0' : (c >= 'a' && c <= 'f') ? c - 'a' + 10 : (c >= 'A' && c <= 'F') ? c - 'A' + 10 : 16;
+				if (digit == 16)
+					return false;
+				code = code * 16 + digit;
+			}
+			return true;
+		}
+
+
+		/// Writes the code point as UTF-8, returns the number of bytes written (at most 4)
+		std::size_t encodeUtf8(unsigned int code, char* out) {
+			if (code < 0x80) {
+				out[0] = static_cast<char>(code);
+				return 1;
+			}
+			if (code < 0x800) {
+				out[0] = static_cast<char>(0xC0 | (code >> 6));
+				out[1] = static_cast<char>(0x80 | (code & 0x3F));
+				return 2;
+			}
+			if (code < 0x10000) {
+				out[0] = static_cast<char>(0xE0 | (code >> 12));
+				out[1] = static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+				out[2] = static_cast<char>(0x80 | (code & 0x3F));
+				return 3;
+			}
+			out[0] = static_cast<char>(0xF0 | (code >> 18));
+			out[1] = static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+			out[2] = static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+			out[3] = static_cast<char>(0x80 | (code & 0x3F));
+			return 4;
+		}
+	}
+
+
+	Value Value::resolve(std::string_view text, Arena& arena) {
+		Value value(text);
+		if (isQuoted(text)) {
+			std::string_view content = text.substr(1, text.size() - 2);
+			if (text[0] == '"' && content.find('\\') != std::string_view::npos) {
+				/*Unescape into the arena*/
+				char* out = static_cast<char*>(arena.allocate(content.size(), 1));
+				std::size_t size = 0;
+				for (std::size_t i = 0; i < content.size(); i++) {
+					char c = content[i];
+					if (c == '\\' && i + 1 < content.size()) {
+						switch (content[++i]) {
+						case 'n': c = '\n'; break;
+						case 't': c = '\t'; break;
+						case 'r': c = '\r'; break;
+						case 'b': c = '\b'; break;
+						case 'f': c = '\f'; break;
+						case '0': c = '\0'; break;
+						case 'u': {
+							/*\uXXXX, a surrogate pair is joined into one code point. The UTF-8 is never longer than the escape*/
+							unsigned int code, low;
+							if (!readHex4(content, i + 1, code)) {
+								c = 'u';
+								break;
+							}
+							i += 4;
+							if (code >= 0xD800 && code < 0xDC00 && i + 2 < content.size() && content[i + 1] == '\\' && content[i + 2] == 'u'
+								&& readHex4(content, i + 3, low) && low >= 0xDC00 && low < 0xE000) {
+								code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+								i += 6;
+							}
+							size += encodeUtf8(code, out + size);
+							continue;
+						}
+						default: c = content[i]; break;		// \\, \", \/ and unknown escapes keep the character
+						}
+					}
+					out[size++] = c;
+				}
+				content = std::string_view(out, size);
+			}
+			value.m_string = { content.data(), content.size() };
+			value.m_type = Type::String;
+		}
+		else if (parseNull(text))
+			value.m_type = Type::Null;
+		else if (parseBool(text, value.m_bool))
+			value.m_type = Type::Bool;
+		else if (parseInt(text, value.m_int))
+			value.m_type = Type::Int;
+		else if (parseDouble(text, value.m_double))
+			value.m_type = Type::Double;
+		else {
+			value.m_string = { text.data(), text.size() };
+			value.m_type = Type::String;
+		}
+		return value;
+	}
+
+
+	bool Value::toBool() const {
+		bool result;
+		if (this->m_type != Type::Raw || !parseBool(this->m_text, result))
+			throw std::runtime_error("ERROR: Yaml value is not a boolean: " + std::string(this->m_text));
+		return result;
+	}
+
+
+	std::int64_t Value::toInt() const {
+		std::int64_t result;
+		if (this->m_type != Type::Raw || !parseInt(this->m_text, result))
+			throw std::runtime_error("ERROR: Yaml value is not an integer: " + std::string(this->m_text));
+		return result;
+	}
+
+
+	void Value::outOfRange() const {
+		throw std::runtime_error("ERROR: Yaml value is out of range: " + std::string(this->m_text));
+	}
+
+
+	double Value::toDouble() const {
+		if (this->m_type == Type::Int)
+			return static_cast<double>(this->m_int);
+		double result;
+		std::int64_t integer;
+		if (this->m_type == Type::Raw && parseInt(this->m_text, integer))
+			return static_cast<double>(integer);
+		if (this->m_type != Type::Raw || !parseDouble(this->m_text, result))
+			throw std::runtime_error("ERROR: Yaml value is not a number: " + std::string(this->m_text));
+		return result;
+	}
+
+
+	std::string_view Value::toString() const {
+		/*Other types are returned as written, only the quotes of the raw text are removed.
+		Unescaping needs an arena, so escaped raw strings are refused instead of returned half decoded*/
+		if (this->m_type == Type::Raw && isQuoted(this->m_text)) {
+			std::string_view content = this->m_text.substr(1, this->m_text.size() - 2);
+			if (this->m_text[0] == '"' && content.find('\\') != std::string_view::npos)
+				throw std::runtime_error("ERROR: Yaml value has escapes, load with resolveScalars or use Value::unquote: " + std::string(this->m_text));
+			return content;
+		}
+		return this->m_text;
+	}
+
+
+	bool Value::isNull() const {
+		return (this->m_type == Type::Raw) ? parseNull(this->m_text) : this->m_type == Type::Null;
+	}
+
+
+	/////////////////////////////// KEY POOL METHODS ///////////////////////////////
+	std::string_view KeyPool::intern(std::string_view key, Arena& arena) {
+		bool full = this->m_count >= TINY_YAML_KEY_POOL_SIZE;
+		if (this->m_count * 2 >= this->m_slots.size() && (!full || this->m_slots.empty()))
+			grow();
+		std::size_t mask = this->m_slots.size() - 1;
+		std::size_t slot = std::hash<std::string_view>()(key) & mask;
+		while (this->m_slots[slot].data() != nullptr) {
+			if (this->m_slots[slot] == key)
+				return this->m_slots[slot];			// Pooled keys are shared even once the pool is full
+			slot = (slot + 1) & mask;
+		}
+		if (full)
+			return arena.store(key);				// Full: copied, not pooled
+		this->m_count++;
+		return this->m_slots[slot] = arena.store(key);
+	}
+
+
+	std::string_view KeyPool::find(std::string_view key) const {
+		if (this->m_slots.empty())
+			return std::string_view();
+		std::size_t mask = this->m_slots.size() - 1;
+		std::size_t slot = std::hash<std::string_view>()(key) & mask;
+		while (this->m_slots[slot].data() != nullptr) {
+			if (this->m_slots[slot] == key)
+				return this->m_slots[slot];
+			slot = (slot + 1) & mask;
+		}
+		return std::string_view();
+	}
+
+
+	void KeyPool::grow() {
+		std::vector<std::string_view> slots(std::max<std::size_t>(this->m_slots.size() * 2, 64));
+		std::size_t mask = slots.size() - 1;
+		for (std::string_view key : this->m_slots) {
+			if (key.data() == nullptr)
+				continue;
+			std::size_t slot = std::hash<std::string_view>()(key) & mask;
+			while (slots[slot].data() != nullptr)
+				slot = (slot + 1) & mask;
+			slots[slot] = key;
+		}
+		this->m_slots.swap(slots);
+	}
+
+
+	void KeyPool::clear() {
+		this->m_slots.clear();
+		this->m_count = 0;
+	}
+
+
+	/////////////////////////////// CHILD LIST METHODS ///////////////////////////////
+	bool ChildList::append(std::string_view key, Node* node) {
+		if (find(key) != nullptr)
+			return false;
+		push(node);
+		this->m_entries[this->m_size - 1].key = key;
+
+		/*Keep the load factor of the index under 1/2*/
+		if (this->m_size > LINEAR_LIMIT) {
+			if (this->m_size * 2 > this->m_indexMask)
+				rebuildIndex();
+			else {
+				std::size_t slot = std::hash<std::string_view>()(key) & this->m_indexMask;
+				while (this->m_index[slot] != 0)
+					slot = (slot + 1) & this->m_indexMask;
+				this->m_index[slot] = this->m_size;
+			}
+		}
+		return true;
+	}
+
+
+	void ChildList::push(Node* node) {
+		if (this->m_size == this->m_capacity)
+			reserve(this->m_capacity * 2);
+		this->m_entries[this->m_size++] = { std::string_view(), node };
+	}
+
+
+	void ChildList::reserve(std::uint32_t capacity) {
+		/*Grow into the arena, the old array is simply abandoned there*/
+		if (capacity <= this->m_capacity)
+			return;
+		Entry* entries = static_cast<Entry*>(this->m_resource->allocate(capacity * sizeof(Entry), alignof(Entry)));
+		std::memcpy(static_cast<void*>(entries), this->m_entries, this->m_size * sizeof(Entry));
+		this->m_entries = entries;
+		this->m_capacity = capacity;
+	}
+
+
+	void ChildList::rebuildIndex() {
+		std::uint32_t slots = 64;
+		while (slots < this->m_size * 4)
+			slots *= 2;
+		this->m_index = static_cast<std::uint32_t*>(this->m_resource->allocate(slots * sizeof(std::uint32_t), alignof(std::uint32_t)));
+		std::memset(this->m_index, 0, slots * sizeof(std::uint32_t));
+		this->m_indexMask = slots - 1;
+		for (std::uint32_t i = 0; i < this->m_size; i++) {
+			std::size_t slot = std::hash<std::string_view>()(this->m_entries[i].key) & this->m_indexMask;
+			while (this->m_index[slot] != 0)
+				slot = (slot + 1) & this->m_indexMask;
+			this->m_index[slot] = i + 1;
+		}
+	}
+
+
+	Node* ChildList::find(std::string_view key) const {
+		if (this->m_index == nullptr) {
+			for (std::uint32_t i = 0; i < this->m_size; i++) {
+				if (sameKey(this->m_entries[i].key, key))
+					return this->m_entries[i].node;
+			}
+			return nullptr;
+		}
+		std::size_t slot = std::hash<std::string_view>()(key) & this->m_indexMask;
+		while (this->m_index[slot] != 0) {
+			const Entry& entry = this->m_entries[this->m_index[slot] - 1];
+			if (sameKey(entry.key, key))
+				return entry.node;
+			slot = (slot + 1) & this->m_indexMask;
+		}
+		return nullptr;
+	}
+
+
+	/////////////////////////////// NODE CLASS METHODS ///////////////////////////////
+	Node::Node(std::string_view identifier, std::string_view value, Arena& arena)
+	: m_identifier(identifier), m_value(value), m_children(&arena)
+	{
+		TINY_YAML_STATS_COUNT(nodes, 1);
+	}
+
 	
-	
-	std::string& Node::getID() {
+	std::string_view Node::getID() const {
 		return this->m_identifier;
 	}
 
 	
-	bool Node::append(std::shared_ptr<Node> node) {
-		std::string& nid = node->getID();
-		if (this->m_children.find(nid) != this->m_children.end())
+	bool Node::append(Node* node) {
+		std::string_view nid = node->getID();
+		if (this->m_kind == Kind::Sequence)
 			return false;
-		this->m_children.insert({ nid, node });
+		this->m_kind = Kind::Mapping;
+		return this->m_children.append(nid, node);
+	}
+
+
+	bool Node::push(Node* node) {
+		if (this->m_kind == Kind::Mapping)
+			return false;
+		this->m_kind = Kind::Sequence;
+		this->m_children.push(node);
 		return true;
 	}
+
+
+	const Node* Node::find(std::string_view identifier) const {
+		expand();
+		if (this->m_kind != Kind::Sequence)
+			return this->m_children.find(identifier);
+		std::size_t index = 0;
+		auto end = identifier.data() + identifier.size();
+		auto [ptr, ec] = std::from_chars(identifier.data(), end, index);
+		if (ec != std::errc() || ptr != end)
+			return nullptr;
+		return this->m_children.at(index);
+	}
+
+
+	template<> std::string& Node::getData<std::string>() {
+		/*Only the materialized data has a destructor to register, the node itself has none*/
+		if (this->m_data == nullptr)
+			this->m_data = static_cast<Arena*>(this->m_children.resource())->create<std::string>(this->m_value.text());
+		return *static_cast<std::string*>(this->m_data);
+	}
+
+
+	template<> std::vector<std::string>& Node::getData<std::vector<std::string>>() {
+		expand();
+		if (this->m_data == nullptr) {
+			auto items = static_cast<Arena*>(this->m_children.resource())->create<std::vector<std::string>>();
+			if (this->m_kind == Kind::Sequence) {
+				for (const Node& item : *this)
+					items->emplace_back(item.getValue());
+			}
+			this->m_data = items;
+		}
+		return *static_cast<std::vector<std::string>*>(this->m_data);
+	}
 	
 
 	/////////////////////////////// YAML CLASS METHODS ///////////////////////////////
-	Yaml::Yaml(const std::string& filepath) {
-		if (!load(filepath))
-			throw std::runtime_error("ERROR: Yaml Parser Object failed during parsing the given file!");
+	namespace {
+		/// Whether the line starts a root key: nothing stays open on the parents stack after it. Root lists (`- item` at column 0) and comments do not.
+		bool opensRoot(std::string_view line) {
+			if (line.empty())
+				return false;
+			switch (line[0]) {
+			case ' ': case '\t': case '\r': case '\n': case '#':
+				return false;
+			case '-':
+				return line.size() > 1 && line[1] != ' ' && line[1] != '\t' && line[1] != '\r' && line[1] != '\n';
+			default:
+				return true;
+			}
+		}
+
+
+		thread_local ParseError t_failure;												// Why the last line parsed on this thread was rejected (its line is set by the caller)
+
+		/// Records why a line is rejected, the column is 0 based
+		bool reject(ParseError::Code code, std::size_t column) {
+			t_failure.code = code;
+			t_failure.line = 0;
+			t_failure.column = static_cast<unsigned int>(column) + 1;
+			t_failure.message = ParseError::describe(code);
+			return false;
+		}
+
+
+		/// Why a parent of the given kind did not take a key
+		ParseError::Code rejectedKey(Node::Kind parent) {
+			return (parent == Node::Kind::Sequence) ? ParseError::Code::MixedCollection : ParseError::Code::DuplicateKey;
+		}
+
+
+		/// Error that is not about a line (the file, an exception while parsing)
+		ParseError failure(ParseError::Code code) noexcept {
+			ParseError error;
+			error.code = code;
+			error.message = ParseError::describe(code);
+			return error;
+		}
+	}
+
+
+
+	Yaml::Yaml() {
+		reset();
+	}
+
+
+	Yaml::Yaml(const std::string& filepath, const LoadOptions& options) {
+		if (!load(filepath, options))
+			throw ParseException("ERROR: Yaml Parser: " + this->m_error, this->m_failure);
 	}
 
 
 	Yaml::~Yaml() {
-		this->m_roots.clear();
+		this->m_arena.reset();		// The nodes go first (unless a later snapshot still uses them)
 	}
 
 
-	bool Yaml::load(const std::string& filepath) {
-		/*Variables*/
-		this->m_roots.clear();
-		std::ifstream file(filepath, std::ios_base::in);
-		std::stack<Triple<std::shared_ptr<Node>, unsigned int, bool>> parentsStack;		// Holds the parents stack pointers, their indentation and if they contain list values.
-		char buf[MAX_CHARACTERS_IN_LINE];
+	void Yaml::reset() {
+		this->m_generation++;
+		this->m_error.clear();
+		this->m_failure = ParseError();
+		this->m_roots = nullptr;
+		if (this->m_arena == nullptr || this->m_arena.use_count() > 1)		// Nodes still used by a later snapshot are left alone
+			this->m_arena = std::make_shared<Arena>();
+		else
+			this->m_arena->rewind();
+		this->m_borrowed.clear();
+		this->m_chunkArenas.clear();
+		this->m_mapping.close();
+		this->m_keys.clear();
+		this->m_stats = LoadStats();
+		this->m_roots = this->m_arena->create<Node>(std::string_view(), std::string_view(), *this->m_arena);
+	}
+
+
+	bool Yaml::load(const std::string& filepath, const LoadOptions& options) {
+		reset();
+		std::ifstream file(filepath, std::ios_base::in | std::ios_base::binary);
 
 		/*Check the yaml file*/
-		if (!file.is_open()) {
-			std::cerr << filepath << " cannot be opened" << std::endl;
-			file.close();
-			return false;
+		if (!file.is_open())
+			return fail(ParseError::Code::CannotOpen, filepath + " cannot be opened");
+		return load(file, options);
+	}
+
+
+	ParseError Yaml::tryLoad(const std::string& filepath, const LoadOptions& options) noexcept {
+		try {
+			load(filepath, options);
+			return this->m_failure;
+		}
+		catch (const std::bad_alloc&) {
+			this->m_failure = failure(ParseError::Code::OutOfMemory);
 		}
+		catch (...) {
+			this->m_failure = failure(ParseError::Code::UnexpectedException);
+		}
+		/*Nothing that can throw in here: no reset(), no message built*/
+		return this->m_failure;
+	}
 
-		/*Read the yaml file line by line*/
+
+	bool Yaml::load(std::istream& stream, const LoadOptions& options) {
+		/*Variables*/
+		reset();
+		TINY_YAML_STATS_LOAD(*this);
+		this->m_options = options;
+		this->m_copyText = true;
 		unsigned int line = 0;
-		bool faulty = false;
-		while (!file.eof() && !faulty) {
-			file.getline(buf, MAX_CHARACTERS_IN_LINE);
+
+		if (options.threads != 1 || options.lazy) {
+			/*A parallel or lazy load needs the whole document: read it into the arena once, the nodes point into that copy*/
+			std::string_view content;
+			{
+				TINY_YAML_STATS_TIME(readSeconds);
+				std::streampos start = stream.tellg();
+				if (start != std::streampos(-1) && stream.seekg(0, std::ios_base::end)) {
+					std::size_t size = static_cast<std::size_t>(stream.tellg() - start);
+					stream.seekg(start);
+					char* buffer = static_cast<char*>(this->m_arena->allocate(std::max<std::size_t>(size, 1), 1));
+					stream.read(buffer, size);
+					content = std::string_view(buffer, static_cast<std::size_t>(stream.gcount()));
+				}
+				else {
+					/*Not seekable (e.g. a pipe)*/
+					stream.clear();
+					std::string text;
+					std::vector<char> block(TINY_YAML_READ_BLOCK_SIZE);
+					while (stream.read(block.data(), block.size()) || stream.gcount() != 0)
+						text.append(block.data(), static_cast<std::size_t>(stream.gcount()));
+					content = this->m_arena->store(text);
+				}
+			}
+			this->m_copyText = false;
+			if (!parseContent(content, line))
+				return fail(line);
+			return true;
+		}
+
+		/*Read the yaml stream line by line*/
+		std::stack<Triple<Node*, unsigned int, bool>> parentsStack;		// Holds the parents stack pointers, their indentation and if they are list items.
+		LineReader reader(stream);
+		std::string_view lineContent;
+		while (reader.next(lineContent)) {
 			line++;
-			if (buf[0] == '\0')
+			TINY_YAML_STATS_COUNT(lines, 1);
+			if (lineContent.empty())
 				continue;
+			if (!parseLine(lineContent, this->m_roots, *this->m_arena, parentsStack))		// Keys and values are copied into the arena, the buffer is reused
+				return fail(line);
+		}
+		return true;
+	}
 
-			/*Get the positions of the yaml textmarks*/
-			std::string lineContent = buf;		// Transform it into a string to use C++ string methods
-
-			std::size_t hashPos = std::string::npos;
-			std::size_t fstQuotePos = std::string::npos;
-			std::size_t lstQuotePos = std::string::npos;
-			std::size_t dashPos = std::string::npos;
-			// Find special characters which takes NO affect if they are in "" or ''
-			for (size_t i = 0; i < lineContent.length(); i++) {
-				char c = lineContent[i];
-				switch (c)
-				{
-				case '-': {
-					// DO NOT update If ' or " then comes and not ended. And if it is already assigned
-					if( !(fstQuotePos != std::string::npos && lstQuotePos == std::string::npos) && dashPos == std::string::npos) {
-						dashPos = i;
-					}}
-					break;
-				case '#' : {
-					// DO NOT update If ' or " comes and not ended. And if # is already found
-					if( hashPos == std::string::npos && !(fstQuotePos != std::string::npos && lstQuotePos == std::string::npos)) {
-						hashPos = i;
-					}}
-					break;
-				case '\'':
-					if(hashPos == std::string::npos && lineContent[i-1] != '\\'){
-						if(fstQuotePos == std::string::npos)
-							fstQuotePos = i;
-						else if(lstQuotePos == std::string::npos && lineContent[fstQuotePos] == c)
-							lstQuotePos = i;
-					}
-					break;
-				case '\"':
-					if(hashPos == std::string::npos && lineContent[i-1] != '\\'){
-						if(fstQuotePos == std::string::npos)
-							fstQuotePos = i;
-						else if(lstQuotePos == std::string::npos && lineContent[fstQuotePos] == c)
-							lstQuotePos = i;
-					}
-					break;
-				default:
-					break;
+
+	bool Yaml::parse(std::string_view text, const LoadOptions& options) {
+		reset();
+		TINY_YAML_STATS_LOAD(*this);
+		this->m_options = options;
+		this->m_copyText = false;
+		unsigned int line = 0;
+		if (!parseContent(text, line))
+			return fail(line);
+		return true;
+	}
+
+
+	bool Yaml::loadMapped(const std::string& filepath, const LoadOptions& options) {
+		/*Variables*/
+		reset();
+		TINY_YAML_STATS_LOAD(*this);
+		this->m_options = options;
+		this->m_copyText = false;
+
+		/*Map the yaml file (its pages are read while parsing)*/
+		bool mapped;
+		{
+			TINY_YAML_STATS_TIME(readSeconds);
+			mapped = this->m_mapping.open(filepath);
+		}
+		if (!mapped)
+			return fail(ParseError::Code::CannotMap, filepath + " cannot be mapped");
+
+		/*Walk the mapping line by line, no line is copied*/
+		unsigned int line = 0;
+		if (!parseContent(this->m_mapping.view(), line))
+			return fail(line);
+		return true;
+	}
+
+
+	bool Yaml::fail(unsigned int line) {
+		reset();
+		this->m_failure = t_failure;
+		this->m_failure.line = line;
+		this->m_error = "invalid yaml syntax at line: " + std::to_string(line);
+		return false;
+	}
+
+
+	bool Yaml::fail(ParseError::Code code, const std::string& error) {
+		reset();
+		this->m_failure = failure(code);
+		this->m_error = error;
+		return false;
+	}
+
+
+	std::vector<LoadResult> Yaml::loadMany(const std::vector<std::string>& filepaths, unsigned int threads, const LoadOptions& options) {
+		/*Variables*/
+		std::vector<LoadResult> results(filepaths.size());
+		if (filepaths.empty())
+			return results;
+		if (threads == 0)
+			threads = std::max(1u, std::thread::hardware_concurrency());
+		threads = static_cast<unsigned int>(std::min<std::size_t>(threads, filepaths.size()));
+
+		/*Every worker owns a contiguous slice of the files. Owner and thieves take files from the same cursor, a file is never loaded twice*/
+		struct alignas(64) Slice {
+			std::atomic<std::size_t> next;
+			std::size_t end;
+		};
+		std::unique_ptr<Slice[]> slices(new Slice[threads]);
+		for (unsigned int i = 0; i < threads; i++) {
+			slices[i].next = filepaths.size() * i / threads;
+			slices[i].end = filepaths.size() * (i + 1) / threads;
+		}
+
+		auto loadFile = [&](std::size_t index) {
+			LoadResult& result = results[index];
+			result.filepath = filepaths[index];
+			try {
+				std::unique_ptr<Yaml> yaml(new Yaml());
+				if (yaml->load(filepaths[index], options))
+					result.yaml = std::move(yaml);
+				else {
+					result.error = yaml->getError();
+					result.failure = yaml->getParseError();
 				}
 			}
-			
-			if(fstQuotePos != std::string::npos && lstQuotePos == std::string::npos){
-				std::cerr << "ERROR: unclosed quote found. Please close the quote and reparse." << std::endl;
-				faulty = true; break;
+			catch (const std::bad_alloc& e) {
+				result.error = e.what();
+				result.failure = failure(ParseError::Code::OutOfMemory);
+			}
+			catch (const std::exception& e) {
+				result.error = e.what();
+				result.failure = failure(ParseError::Code::UnexpectedException);
+			}
+		};
+
+		auto work = [&](unsigned int self) {
+			for (unsigned int k = 0; k < threads; k++) {
+				Slice& slice = slices[(self + k) % threads];			// Own slice first, then steal from the next ones
+				for (std::size_t index = slice.next.fetch_add(1); index < slice.end; index = slice.next.fetch_add(1))
+					loadFile(index);
 			}
+		};
 
-			if (hashPos != std::string::npos) 
-				lineContent.erase(hashPos);
+		/*The calling thread works too. If a thread can not be started the remaining workers steal its slice*/
+		std::vector<std::thread> workers;
+		workers.reserve(threads - 1);
+		for (unsigned int i = 1; i < threads; i++) {
+			try {
+				workers.emplace_back(work, i);
+			}
+			catch (const std::system_error&) {
+				break;
+			}
+		}
+		work(0);
+		for (std::thread& worker : workers)
+			worker.join();
+		return results;
+	}
 
-			std::size_t colonPos = lineContent.find(':');
-			std::size_t firstCharPos = lineContent.find_first_not_of(" -#\t\f\v\n\r");
-			std::size_t lastCharPos = lineContent.find_last_not_of(" #\t\f\v\n\r");
 
-			/*Validation layers*/
-			if (firstCharPos == std::string::npos)		// If line is empty (Only white spaces), read next line
+	bool Yaml::parseLines(std::string_view content, Node* roots, Arena& arena, std::stack<Triple<Node*, unsigned int, bool>>& parentsStack, unsigned int& line) {
+		while (!content.empty()) {
+			std::size_t eol = content.find('\n');
+			std::string_view lineContent = content.substr(0, eol);
+			content.remove_prefix(eol == std::string_view::npos ? content.size() : eol + 1);
+			line++;
+			TINY_YAML_STATS_COUNT(lines, 1);
+			if (lineContent.empty())
+				continue;
+			if (!parseLine(lineContent, roots, arena, parentsStack))
+				return false;
+		}
+		return true;
+	}
+
+
+	bool Yaml::parseChunk(std::string_view content, Node* roots, Arena& arena, unsigned int& line) {
+		std::stack<Triple<Node*, unsigned int, bool>> parentsStack;		// Holds the parents stack pointers, their indentation and if they are list items.
+		return parseLines(content, roots, arena, parentsStack, line);
+	}
+
+
+	bool Yaml::parseContent(std::string_view content, unsigned int& line) {
+		/*Variables*/
+		unsigned int threads = (this->m_options.threads == 0) ? std::max(1u, std::thread::hardware_concurrency()) : this->m_options.threads;
+		std::size_t chunks = std::min<std::size_t>(threads, content.size() / TINY_YAML_PARALLEL_CHUNK_SIZE);
+		TINY_YAML_STATS_COUNT(bytesRead, content.size());
+		if (this->m_options.lazy)
+			return parseLazy(content, line);
+
+		/*Split at lines starting a root key: nothing is open on the parents stack there*/
+		std::vector<std::size_t> starts(1, 0);
+		for (std::size_t i = 1; i < chunks; i++) {
+			std::size_t pos = std::max(content.size() * i / chunks, starts.back() + 1);
+			while ((pos = content.find('\n', pos)) != std::string_view::npos && !opensRoot(content.substr(++pos))) {}
+			if (pos == std::string_view::npos || pos >= content.size())
+				break;
+			starts.push_back(pos);
+		}
+		if (starts.size() == 1)
+			return parseChunk(content, this->m_roots, *this->m_arena, line);
+
+		/*The first chunk is parsed straight into the roots, the others into their own arena*/
+		struct Chunk {
+			std::string_view content;
+			Node* roots;
+			Arena* arena;
+			unsigned int lines = 0;
+			bool ok = true;
+			ParseError failure;															// Why the chunk failed, its line is relative to the chunk
+			LoadStats stats;
+		};
+		std::vector<Chunk> parts(starts.size());
+		for (std::size_t i = 0; i < starts.size(); i++) {
+			std::size_t end = (i + 1 < starts.size()) ? starts[i + 1] : content.size();
+			parts[i].content = content.substr(starts[i], end - starts[i]);
+			if (i == 0) {
+				parts[i].roots = this->m_roots;
+				parts[i].arena = this->m_arena.get();
 				continue;
-		
-			if (colonPos == dashPos && dashPos == std::string::npos) { // No dash and no colon in the line => Invalid
-				faulty = true; break;
 			}
+			this->m_chunkArenas.emplace_back(new Arena());
+			parts[i].arena = this->m_chunkArenas.back().get();
+			parts[i].roots = parts[i].arena->create<Node>(std::string_view(), std::string_view(), *parts[i].arena);
+		}
 
-			/*Starting building the pnode*/
-			std::shared_ptr<Node> pnode;
-			std::size_t nodeLastCharPos = (colonPos <= lastCharPos) ? colonPos : lastCharPos+1;
-			std::string nodeID = lineContent.substr(firstCharPos, nodeLastCharPos - firstCharPos);				// Can be the pnode id or the array values.
-			
-			/* Layer up. (Current line has less indentation than the previous parent = does not belong to it)*/
-			while (parentsStack.size() != 0 && parentsStack.top().second >= firstCharPos) {
-				parentsStack.pop();
+		auto work = [&](Chunk& chunk) {
+			TINY_YAML_STATS_SCOPE(chunk.stats, this->m_statsEpoch, "chunk", static_cast<std::uint32_t>(&chunk - parts.data()));
+			try {
+				chunk.ok = parseChunk(chunk.content, chunk.roots, *chunk.arena, chunk.lines);
+				if (!chunk.ok)
+					chunk.failure = t_failure;
+			}
+			catch (const std::bad_alloc&) {
+				chunk.ok = false;
+				chunk.failure = failure(ParseError::Code::OutOfMemory);
 			}
-			
-			/* List of nodes/items */
-			if (dashPos != std::string::npos) {
-				/*a dash should alway come in the beginning*/
-				if ((parentsStack.top().first->getSize() != 0 && !parentsStack.top().third) || parentsStack.size() == 0) { 
-					faulty = true;
-					std::cerr << "ERROR: Variable " << nodeID << " contains a '-' at column " << dashPos << ". A Dash must not exist there." << std::endl;
+			catch (const std::exception&) {
+				chunk.ok = false;
+				chunk.failure = failure(ParseError::Code::UnexpectedException);
+			}
+		};
+
+		/*The calling thread parses the first chunk. If a thread can not be started its chunk is parsed here too*/
+		std::vector<std::thread> workers;
+		std::size_t started = 1;
+		for (; started < parts.size(); started++) {
+			try {
+				workers.emplace_back(work, std::ref(parts[started]));
+			}
+			catch (const std::system_error&) {
+				break;
+			}
+		}
+		work(parts[0]);
+		for (std::size_t i = started; i < parts.size(); i++)
+			work(parts[i]);
+		for (std::thread& worker : workers)
+			worker.join();
+#if TINY_YAML_STATS
+		for (Chunk& chunk : parts)
+			this->m_stats.merge(chunk.stats);
+#endif
+
+		/*Merge in document order. As in a single pass, a duplicated root value (a scalar or a flow collection) is ignored and a duplicated
+		root parent (a `key:` line) is an error. The line of a root tells which kind it is: the keys point into the document, except the
+		quoted keys with escapes, unescaped into the arena. Those are found again on the first root line of the chunk with the same key*/
+		Arena scratch;
+		auto lineOf = [&scratch](std::string_view content, const Node& root) {
+			std::less<const char*> before;
+			const char* key = root.getID().data();
+			if (!before(key, content.data()) && before(key, content.data() + content.size()))
+				return content.rfind('\n', static_cast<std::size_t>(key - content.data())) + 1;		// npos + 1 is the first line
+			for (std::size_t begin = 0; begin < content.size(); begin = content.find('\n', begin) + 1) {
+				std::size_t end = std::min(content.find('\n', begin), content.size());
+				LineParts line;
+				if (opensRoot(content.substr(begin)) && splitLine(content.substr(begin, end - begin), line) && line.colon != std::string_view::npos
+					&& Value::unquote(line.key, scratch) == root.getID())
+					return begin;
+				if (end == content.size())
 					break;
+			}
+			return std::size_t(0);
+		};
+		auto isParent = [](std::string_view content, std::size_t begin) {
+			std::size_t end = std::min(content.find('\n', begin), content.size());
+			LineParts line;
+			return splitLine(content.substr(begin, end - begin), line) && line.colon == line.lastChar;
+		};
+		for (std::size_t i = 0; i < parts.size(); i++) {
+			if (i != 0) {
+				for (Node& root : *parts[i].roots) {
+					if (this->m_roots->append(&root))
+						continue;
+					std::size_t begin = lineOf(parts[i].content, root);
+					if (isParent(parts[i].content, begin)) {
+						line += 1 + static_cast<unsigned int>(std::count(parts[i].content.data(), parts[i].content.data() + begin, '\n'));
+						return reject(ParseError::Code::DuplicateKey, 0);
+					}
 				}
+			}
+			line += parts[i].lines;
+			if (!parts[i].ok) {
+				t_failure = parts[i].failure;
+				return false;
+			}
+		}
+		return true;
+	}
 
-				parentsStack.top().third = true;		// The current parrent is found to have list items
-				/*If dash comes with colon => we create a virtual node that has internal nodes */
-				if (colonPos != std::string::npos) {
-					
-					/* Since the virtual nodes indentation = dashpos, we have to consider the dashpos now*/
-					while (parentsStack.size() != 0 && parentsStack.top().second >= dashPos) {
-						parentsStack.pop();
-					}
 
-					/*Create the virtual pnode*/
-					std::string id = std::to_string(parentsStack.top().first->getSize());		// Create the virtual node ID
-					pnode = std::make_shared<Node>(Node(id, nullptr));							// Create a virtual pnode
+	bool Yaml::parseLazy(std::string_view content, unsigned int& line) {
+		/*Only the lines of the root keys are parsed now (duplicated roots are still found), the lines below a root parent are kept for later*/
+		std::stack<Triple<Node*, unsigned int, bool>> parentsStack;		// Holds the parents stack pointers, their indentation and if they are list items.
+		Node* parent = nullptr;											// Root parent whose lines are being skipped
+		std::size_t bodyBegin = 0;
+		unsigned int parentLine = 0;
 
-					/*Append the node to the current parent*/
-					if (!parentsStack.top().first->append(pnode)) {
-						faulty = true;
-						break;
-					}
-					/*Make the current node the new parent*/
-					parentsStack.push(Triple<std::shared_ptr<Node>, unsigned int, bool>(pnode, dashPos, true));
-					dashPos = std::string::npos;	
-				}
-				else { /* A list of elements inside the current parent pnode */
-					std::vector<std::string>* pvect = &parentsStack.top().first.get()->getData<std::vector<std::string>>();		// Get the current data
-					if (pvect == nullptr) {		// Create teh data if it is null
-						std::shared_ptr<void> temp = std::make_shared<std::vector<std::string>>();
-						parentsStack.top().first.get()->setData(temp);
-					}
-					pvect = &parentsStack.top().first.get()->getData<std::vector<std::string>>();
-					pvect->push_back(nodeID);
-					continue;
+		auto keep = [&](std::size_t bodyEnd) {
+			if (parent != nullptr && bodyBegin < bodyEnd)
+				parent->m_lazy = this->m_arena->create<LazyBlock>(content.substr(bodyBegin, bodyEnd - bodyBegin), parentLine, this);
+			parent = nullptr;
+		};
+
+		std::size_t pos = 0;
+		while (pos < content.size()) {
+			std::size_t eol = content.find('\n', pos);
+			std::size_t next = (eol == std::string_view::npos) ? content.size() : eol + 1;
+			std::string_view lineContent = content.substr(pos, next - pos - (eol == std::string_view::npos ? 0 : 1));
+			line++;
+			TINY_YAML_STATS_COUNT(lines, 1);
+			if (opensRoot(lineContent)) {
+				keep(pos);
+				while (!parentsStack.empty())
+					parentsStack.pop();
+				if (!parseLine(lineContent, this->m_roots, *this->m_arena, parentsStack))
+					return false;
+				if (!parentsStack.empty()) {
+					parent = parentsStack.top().first;
+					bodyBegin = next;
+					parentLine = line;
 				}
 			}
+			else if (parent == nullptr && !lineContent.empty() && !parseLine(lineContent, this->m_roots, *this->m_arena, parentsStack))
+				return false;		// Not below a root parent (e.g. leading lines), parsed as usual
+			pos = next;
+		}
+		keep(content.size());
+		return true;
+	}
 
-			/*If the current node is a parent node with children nodes*/
-			if (colonPos == lastCharPos && colonPos != std::string::npos) {
-				pnode = std::make_shared<Node>(Node(nodeID, nullptr));
 
-				if (parentsStack.size() == 0 && this->m_roots.find(nodeID) == this->m_roots.end()){ // If the node is at root level, we add it to the root
-					this->m_roots.insert({ nodeID, pnode });
-				}
-				else if(parentsStack.size() == 0 && this->m_roots.find(nodeID) != this->m_roots.end()) { // If it is at root level and it exists already, we return false
-					faulty = true; break;
+	void Node::materialize() const {
+		LazyBlock& block = *this->m_lazy;
+		Yaml& yaml = *block.yaml;
+		{
+			std::lock_guard<std::mutex> lock(yaml.m_lazyMutex);
+			if (!block.done.load(std::memory_order_relaxed)) {
+				TINY_YAML_STATS_SCOPE(yaml.m_stats, yaml.m_statsEpoch, "materialize", 0);
+
+				/*Same state as a single pass right after the key line*/
+				std::stack<Triple<Node*, unsigned int, bool>> parentsStack;
+				parentsStack.push(Triple<Node*, unsigned int, bool>(const_cast<Node*>(this), 0, false));
+				unsigned int line = block.line;
+				if (!yaml.parseLines(block.text, yaml.m_roots, *yaml.m_arena, parentsStack, line)) {
+					block.failure = t_failure;
+					block.failure.line = line;
 				}
-				else if (parentsStack.size() != 0 && !parentsStack.top().first->append(pnode)) { // If it is not at root level and it is failed to attach the current node to the current parent
-					faulty = true; break;
+				block.done.store(true, std::memory_order_release);
+			}
+		}
+		if (!block.failure.ok())
+			throw ParseException("ERROR: Yaml Parser: invalid yaml syntax at line: " + std::to_string(block.failure.line), block.failure);
+	}
+
+
+	bool Yaml::parseLine(std::string_view lineContent, Node* roots, Arena& arena, std::stack<Triple<Node*, unsigned int, bool>>& parentsStack) {
+		/*Split the line into its key, value and list mark. Special characters take NO affect if they are in "" or ''*/
+		TINY_YAML_STATS_TIME(scanSeconds);
+		LineParts parts;
+		if (!splitLine(lineContent, parts))
+			return reject(ParseError::Code::UnclosedQuote, parts.firstChar);
+		TINY_YAML_STATS_SPLIT(scanSeconds, buildSeconds);
+
+		std::size_t dashPos = parts.dash;
+		std::size_t colonPos = parts.colon;
+		std::size_t firstCharPos = parts.firstChar;
+		std::size_t lastCharPos = parts.lastChar;
+
+		/*Validation layers*/
+		if (firstCharPos == std::string::npos)		// If line is empty (Only white spaces), read next line
+			return true;
+	
+		if (colonPos == dashPos && dashPos == std::string::npos) { // No dash and no colon in the line => Invalid
+			return reject(ParseError::Code::MissingColon, firstCharPos);
+		}
+
+		/*Starting building the pnode*/
+		Node* pnode;
+		std::string_view nodeID = parts.key;			// Can be the pnode id or the array values.
+		bool flowItem = dashPos != std::string::npos && isFlow(lineContent.substr(firstCharPos));		// `- [a, b]` or `- {a: 1}`, its colons are inside the collection
+		if (colonPos != std::string::npos && !flowItem)
+			nodeID = Value::unquote(nodeID, arena);		// Keys are stored without their quotes, like the keys of JSON documents
+		if (this->m_copyText && !flowItem)
+			nodeID = (dashPos != std::string::npos && colonPos == std::string::npos) ? arena.store(nodeID) : this->m_keys.intern(nodeID, arena);	// Every occurrence of a key shares one copy
+		
+		/* Layer up. (Current line has less indentation than the previous parent = does not belong to it)*/
+		while (parentsStack.size() != 0 && parentsStack.top().second >= firstCharPos) {
+			parentsStack.pop();
+		}
+		
+		/* List of nodes/items */
+		if (dashPos != std::string::npos) {
+			/* The items belong to the closest parent left of the dash (or at the dash column, e.g. `key:` followed by `- item`). A previous item at the dash column is a sibling.*/
+			while (parentsStack.size() != 0 && parentsStack.top().second > dashPos) {
+				parentsStack.pop();
+			}
+			if (parentsStack.size() != 0 && parentsStack.top().second == dashPos && parentsStack.top().third) {
+				parentsStack.pop();
+			}
+
+			/*a dash should alway come in the beginning*/
+			if (parentsStack.size() == 0 || parentsStack.top().first->m_kind == Node::Kind::Mapping) { 
+				return reject(ParseError::Code::MisplacedDash, dashPos);
+			}
+
+			/*A flow collection item, its content is parsed right away*/
+			if (flowItem) {
+				pnode = arena.create<Node>(std::string_view(), std::string_view(), arena);
+				parentsStack.top().first->push(pnode);
+				return parseFlow(lineContent.substr(firstCharPos, lastCharPos + 1 - firstCharPos), firstCharPos, pnode, arena);
+			}
+
+			/*If dash comes with colon => the item is a virtual node that has internal nodes */
+			if (colonPos != std::string::npos) {
+				pnode = arena.create<Node>(std::string_view(), std::string_view(), arena);
+				parentsStack.top().first->push(pnode);
+
+				/*Make the current node the new parent*/
+				parentsStack.push(Triple<Node*, unsigned int, bool>(pnode, dashPos, true));
+				TINY_YAML_STATS_MAX(maxDepth, parentsStack.size());
+				dashPos = std::string::npos;	
+			}
+			else { /* A scalar item */
+				pnode = arena.create<Node>(std::string_view(), nodeID, arena);
+				if (this->m_options.resolveScalars)
+					pnode->m_value = Value::resolve(nodeID, arena);
+				parentsStack.top().first->push(pnode);
+				return true;
+			}
+		}
+
+		/*If the current node is a parent node with children nodes*/
+		if (colonPos == lastCharPos && colonPos != std::string::npos) {
+			pnode = arena.create<Node>(nodeID, std::string_view(), arena);
+
+			if (parentsStack.size() == 0 && !roots->append(pnode)){ // If the node is at root level and it exists already, we return false
+				return reject(ParseError::Code::DuplicateKey, firstCharPos);
+			}
+			else if (parentsStack.size() != 0 && !parentsStack.top().first->append(pnode)) { // If it is not at root level and it is failed to attach the current node to the current parent
+				return reject(rejectedKey(parentsStack.top().first->m_kind), firstCharPos);
+			}
+			parentsStack.push(Triple<Node*, unsigned int, bool>(pnode, firstCharPos, false));
+			TINY_YAML_STATS_MAX(maxDepth, parentsStack.size());
+			return true;
+		}
+
+		/*Single Node containing a value"*/
+		if (colonPos < lastCharPos && lastCharPos != std::string::npos ) {
+			/*value extraction. A flow collection becomes the children of the node*/
+			std::string_view value = parts.value;
+			bool flow = isFlow(value);
+			if (this->m_copyText && !flow)
+				value = arena.store(value);
+
+			/*Build pnode*/
+			pnode = arena.create<Node>(nodeID, flow ? std::string_view() : value, arena);
+			if (this->m_options.resolveScalars && !flow)
+				pnode->m_value = Value::resolve(value, arena);
+
+			if(parentsStack.size() == 0) {	// Insert at root level, a duplicated root value is ignored
+				roots->append(pnode);
+			}
+			else if (parentsStack.size() != 0  && !parentsStack.top().first->append(pnode)) {	// Insert at parent level
+				return reject(rejectedKey(parentsStack.top().first->m_kind), firstCharPos);
+			}
+			if (flow)
+				return parseFlow(value, static_cast<std::size_t>(value.data() - lineContent.data()), pnode, arena);
+		}
+		return true;
+	}
+
+
+	bool Yaml::parseFlow(std::string_view text, std::size_t column, Node* node, Arena& arena) {
+		/*One pass from left to right: the collections still open are on the stack, every entry is added as soon as it is read*/
+		std::vector<Node*> open;
+		std::size_t pos = 0;
+		bool separated = true;										// A comma (or the opening bracket) came after the last entry
+		auto enter = [&](Node* collection) {
+			collection->m_kind = (text[pos++] == '[') ? Node::Kind::Sequence : Node::Kind::Mapping;
+			open.push_back(collection);
+			separated = true;
+		};
+		auto copy = [&](std::string_view token, bool key) {
+			if (!this->m_copyText)
+				return token;
+			return key ? this->m_keys.intern(token, arena) : arena.store(token);
+		};
+
+		enter(node);
+		while (!open.empty()) {
+			skipFlowBlanks(text, pos);
+			if (pos >= text.size())
+				return reject(ParseError::Code::InvalidFlow, column + pos);
+			Node* parent = open.back();
+			bool sequence = parent->m_kind == Node::Kind::Sequence;
+
+			/*End of the collection (a trailing comma is allowed), or the comma after an entry*/
+			if (text[pos] == (sequence ? ']' : '}')) {
+				open.pop_back();
+				pos++;
+				separated = false;
+				continue;
+			}
+			if (!separated) {
+				if (text[pos] != ',')
+					return reject(ParseError::Code::InvalidFlow, column + pos);
+				pos++;
+				separated = true;
+				continue;
+			}
+
+			/*Key of a mapping entry (`{a}` and `{a: }` have no value)*/
+			std::string_view key;
+			std::size_t keyPos = pos;
+			if (!sequence) {
+				if (!readFlowScalar(text, pos, ":,}", key) || key.empty())
+					return reject(ParseError::Code::InvalidFlow, column + pos);
+				key = copy(Value::unquote(key, arena), true);
+				skipFlowBlanks(text, pos);
+				if (pos < text.size() && text[pos] == ':') {
+					pos++;
+					skipFlowBlanks(text, pos);
 				}
-				parentsStack.push(Triple<std::shared_ptr<Node>, unsigned int, bool>(pnode, firstCharPos, false));
+			}
+
+			/*Value: a nested collection or a scalar*/
+			Node* child = arena.create<Node>(key, std::string_view(), arena);
+			if (sequence ? !parent->push(child) : !parent->append(child))
+				return reject(ParseError::Code::DuplicateKey, column + keyPos);
+			if (pos < text.size() && (text[pos] == '[' || text[pos] == '{')) {
+				enter(child);
 				continue;
 			}
+			std::string_view value;
+			if (!readFlowScalar(text, pos, sequence ? ",]" : ",}", value) || (sequence && value.empty()))
+				return reject(ParseError::Code::InvalidFlow, column + pos);
+			value = copy(value, false);
+			child->m_value = this->m_options.resolveScalars ? Value::resolve(value, arena) : Value(value);
+			separated = false;
+		}
+
+		/*Only blanks may follow the outer collection (the comment is already cut)*/
+		skipFlowBlanks(text, pos);
+		if (pos != text.size())
+			return reject(ParseError::Code::InvalidFlow, column + pos);
+		return true;
+	}
 
-			/*Single Node containing a value"*/
-			if (colonPos < lastCharPos && lastCharPos != std::string::npos ) {
-				/*value extraction*/
-				std::string value = lineContent.substr(colonPos + 1, lastCharPos - colonPos); // value extraction.
-				value.erase(0, value.find_first_not_of(" \t\f\v\n\r"));
+	bool Yaml::same(const Node& a, const Node& b) {
+		if (a.m_kind != b.m_kind || a.m_value.text() != b.m_value.text() || a.m_children.size() != b.m_children.size())
+			return false;
+		for (std::uint32_t i = 0; i < a.m_children.size(); i++) {
+			const ChildList::Entry& left = a.m_children.begin()[i];
+			const ChildList::Entry& right = b.m_children.begin()[i];
+			if (left.key != right.key || !same(*left.node, *right.node))
+				return false;
+		}
+		return true;
+	}
 
-				/*Build pnode*/
-				pnode = std::make_shared<Node>(Node(nodeID, std::make_shared<std::string>(value)));
 
-				if(parentsStack.size() == 0 && this->m_roots.find(nodeID) == this->m_roots.end()){	// Insert at root level
-						this->m_roots.insert({ nodeID, pnode });
-				}
-				else if (parentsStack.size() != 0  && !parentsStack.top().first->append(pnode)) {	// Insert at parent level
-					faulty = true;
-					break;
+	void Yaml::reuse(Node& fresh, Node& old, std::string& path, std::vector<Change>& changes, std::vector<Node*>& reused) {
+		std::size_t length = path.size();
+		auto enter = [&](std::string_view key) {
+			path.resize(length);
+			if (length != 0)
+				path += '.';
+			path += key;
+		};
+
+		/*Children of the new node: equal subtrees are replaced by the old ones, different containers are compared deeper*/
+		bool sequence = fresh.m_kind == Node::Kind::Sequence;
+		bool comparable = fresh.m_kind == old.m_kind;
+		for (std::uint32_t i = 0; i < fresh.m_children.size(); i++) {
+			const ChildList::Entry& entry = fresh.m_children.begin()[i];
+			enter(sequence ? std::string_view(std::to_string(i)) : entry.key);
+			Node* previous = !comparable ? nullptr : (sequence ? old.m_children.at(i) : old.m_children.find(entry.key));
+			if (previous == nullptr)
+				changes.push_back({ path, Change::Type::Added });
+			else if (same(*entry.node, *previous)) {
+				fresh.m_children.replace(i, previous);
+				reused.push_back(previous);
+			}
+			else if (entry.node->m_kind != Node::Kind::Scalar && entry.node->m_kind == previous->m_kind)
+				reuse(*entry.node, *previous, path, changes, reused);
+			else
+				changes.push_back({ path, Change::Type::Modified });
+		}
+
+		/*Children of the old node that are gone*/
+		for (std::uint32_t i = 0; i < old.m_children.size(); i++) {
+			const ChildList::Entry& entry = old.m_children.begin()[i];
+			bool kept = comparable && (sequence ? i < fresh.m_children.size() : fresh.m_children.find(entry.key) != nullptr);
+			if (!kept) {
+				enter((old.m_kind == Node::Kind::Sequence) ? std::string_view(std::to_string(i)) : entry.key);
+				changes.push_back({ path, Change::Type::Removed });
+			}
+		}
+		path.resize(length);
+	}
+
+
+	void Yaml::borrow(const Yaml& old, const std::vector<Node*>& reused) {
+		/*Keep alive the arenas holding the reused nodes only, so old snapshots are released once nothing points into them*/
+		std::vector<std::shared_ptr<Arena>> candidates(old.m_borrowed);
+		candidates.push_back(old.m_arena);
+		std::vector<bool> used(candidates.size(), false);
+		std::size_t last = candidates.size() - 1;
+
+		std::vector<const Node*> pending(reused.begin(), reused.end());
+		while (!pending.empty()) {
+			const Node* node = pending.back();
+			pending.pop_back();
+			if (!candidates[last]->contains(node)) {
+				for (std::size_t i = 0; i < candidates.size(); i++) {
+					if (candidates[i]->contains(node)) {
+						last = i;
+						break;
+					}
 				}
 			}
-		
+			used[last] = true;
+			for (const ChildList::Entry& entry : node->m_children)
+				pending.push_back(entry.node);
 		}
-		
-		if (faulty) {
-			std::cerr << "Yaml Parser: Error: Failed to parse file, invalid yaml syntax at line: " << line << std::endl;
-			file.close();
-			this->m_roots.clear();
+		for (std::size_t i = 0; i < candidates.size(); i++) {
+			if (used[i])
+				this->m_borrowed.push_back(candidates[i]);
+		}
+	}
+
+
+	/////////////////////////////// LIVE YAML METHODS ///////////////////////////////
+	namespace {
+		/// Reloaded snapshots share their arenas: every node has to live in the arena, so the text is copied and no chunk arena is used
+		LoadOptions snapshotOptions(LoadOptions options) {
+			options.threads = 1;
+			options.lazy = false;
+			return options;
+		}
+	}
+
+
+	LiveYaml::LiveYaml(const std::string& filepath, const LoadOptions& options)
+	: m_filepath(filepath), m_options(snapshotOptions(options)), m_current(std::make_shared<Yaml>())
+	{
+		if (!this->m_current->load(filepath, this->m_options))
+			throw ParseException("ERROR: Yaml Parser: " + this->m_current->getError(), this->m_current->getParseError());
+	}
+
+
+	bool LiveYaml::reload(std::vector<Change>& changes) {
+		std::lock_guard<std::mutex> lock(this->m_reloadMutex);
+		changes.clear();
+		std::shared_ptr<Yaml> fresh = std::make_shared<Yaml>();
+		if (!fresh->load(this->m_filepath, this->m_options)) {
+			this->m_error = fresh->getError();
 			return false;
 		}
+		this->m_error.clear();
 
-		file.close();
+		std::shared_ptr<Yaml> current = snapshot();
+		std::string path;
+		std::vector<Node*> reused;
+		fresh->reuse(*fresh->m_roots, *current->m_roots, path, changes, reused);
+		if (changes.empty())
+			return true;
+		fresh->borrow(*current, reused);
+		std::atomic_store(&this->m_current, fresh);
 		return true;
 	}
 
-	// For future release if needed.
-	/*bool Yaml::save(const std::string& filepath) {
-		return true;
-	}*/
 
+	/////////////////////////////// DOCUMENT STREAM METHODS ///////////////////////////////
+	namespace {
+		/// Whether the line is the given document marker (`---` or `...`), alone or followed by a blank
+		bool isMarker(std::string_view line, std::string_view marker) {
+			return line.substr(0, 3) == marker && (line.size() == 3 || line[3] == ' ' || line[3] == '\t' || line[3] == '\r');
+		}
+	}
 
 
-}
+	DocumentStream::DocumentStream(std::istream& stream)
+	: m_reader(stream)
+	{}
+
+
+	DocumentStream::DocumentStream(const std::string& filepath)
+	: m_file(filepath, std::ios_base::in | std::ios_base::binary), m_reader(m_file)
+	{
+		if (!this->m_file.is_open())
+			this->m_error = filepath + " cannot be opened";
+	}
 
 
+	bool DocumentStream::next(Yaml& document, const LoadOptions& options) {
+		/*Variables*/
+		document.reset();
+		TINY_YAML_STATS_LOAD(document);
+		document.m_options = options;
+		document.m_copyText = true;
+		std::stack<Triple<Node*, unsigned int, bool>> parentsStack;		// Holds the parents stack pointers, their indentation and if they are list items.
+		bool found = this->m_explicit;		// Whether there is a document (started by `---` or holding some content)
+		unsigned int faultyLine = 0;
+		this->m_explicit = false;
+		bool gather = options.threads != 1 || options.lazy;		// The whole document is needed, it is parsed once its end is reached
+		unsigned int firstLine = this->m_line;						// Line before the gathered ones
+		this->m_text.clear();
+
+		std::string_view lineContent;
+		while (this->m_reader.next(lineContent)) {
+			this->m_line++;
+			bool start = isMarker(lineContent, "---");
+			if (start || isMarker(lineContent, "...")) {
+				if (found) {
+					this->m_explicit = start;
+					break;
+				}
+				found = start;
+				this->m_text.clear();
+				firstLine = this->m_line;
+				continue;
+			}
+			std::size_t firstChar = lineContent.find_first_not_of(" \t\r");
+			found = found || (firstChar != std::string_view::npos && lineContent[firstChar] != '#');
+			if (gather) {
+				this->m_text.append(lineContent).push_back('\n');		// Blank lines too, to keep the line numbers
+				continue;
+			}
 
+			TINY_YAML_STATS_COUNT(lines, 1);
+			if (lineContent.empty() || faultyLine != 0)
+				continue;
+			if (!document.parseLine(lineContent, document.m_roots, *document.m_arena, parentsStack))
+				faultyLine = this->m_line;		// The rest of the document is skipped
+		}
 
+		if (gather && found) {
+			/*One copy into the arena, the nodes (and the lazy blocks) point into it*/
+			document.m_copyText = false;
+			unsigned int line = firstLine;
+			if (!document.parseContent(document.m_arena->store(this->m_text), line))
+				document.fail(line);
+		}
+		if (faultyLine != 0)
+			document.fail(faultyLine);		// Nothing was parsed after the faulty line, its reason is still the last one
+		return found;
+	}
+
+
+	Path Yaml::compile(std::string_view path) {
+		std::vector<std::string> segments;
+		while (true) {
+			std::size_t dot = path.find('.');
+			segments.emplace_back(path.substr(0, dot));
+			if (dot == std::string_view::npos)
+				break;
+			path.remove_prefix(dot + 1);
+		}
+		return Path(*this, std::move(segments));
+	}
+
+
+	Path Yaml::compile(const std::vector<std::string>& segments) {
+		return Path(*this, segments);
+	}
+
+
+	/////////////////////////////// PATH METHODS ///////////////////////////////
+	Path::Path(Yaml& yaml, std::vector<std::string> segments)
+	: m_yaml(&yaml), m_segments(std::move(segments)), m_generation(yaml.m_generation - 1)
+	{}
+
+
+	Path::Path(const Path& other)
+	: m_yaml(other.m_yaml), m_segments(other.m_segments), m_generation(other.m_yaml->m_generation - 1)
+	{}
+
+
+	Path& Path::operator=(const Path& other) {
+		if (this != &other) {
+			this->m_yaml = other.m_yaml;
+			this->m_segments = other.m_segments;
+			this->m_node.store(nullptr, std::memory_order_relaxed);
+			this->m_generation.store(other.m_yaml->m_generation - 1, std::memory_order_relaxed);
+		}
+		return *this;
+	}
+
+
+	Node* Path::resolve() {
+		Node* node = this->m_yaml->m_roots;
+		for (const auto& segment : this->m_segments) {
+			node = node->find(segment);
+			if (node == nullptr)
+				break;
+		}
+		this->m_node.store(node, std::memory_order_relaxed);
+		this->m_generation.store(this->m_yaml->m_generation, std::memory_order_release);
+		return node;
+	}
+
+
+	Node& Path::operator*() {
+		Node* node = get();
+		if (node == nullptr)
+			throw std::out_of_range("ERROR: Yaml path does not exist in the document");
+		return *node;
+	}
+
+}
@@ -19,8 +19,9 @@
 *				<node_ID>: <value>
 *
 * Notes:
-*	- All values are stored as strings. The developer will have to go through changing a string to number if needed. (e.g: if value is 123, it is stored as string)
-*	- At the moment there is no save into file function since it is using the std::unordered_map for storing the children nodes.
+*	- Values keep their raw text. `as<T>()` converts it on access, or once while loading with LoadOptions::resolveScalars (e.g: `yaml["version"].as<int>()`).
+*	  Double quoted strings with escapes are only unescaped by resolveScalars (or Value::unquote), `as<std::string_view>()` throws on them otherwise.
+*	- Yaml::save writes the tree back in block style.
 *	- This is a light-weight library, meaning that it will not handle exceptions and missuse of data. For instance, accessing a node that does not exist will not be handled by the library. 
 * 
 * 
@@ -74,118 +75,1476 @@
 #ifndef TINY_YAML_PARSER
 #define TINY_YAML_PARSER
 
-#define MAX_CHARACTERS_IN_LINE 512
+#ifndef TINY_YAML_READ_BLOCK_SIZE
+#define TINY_YAML_READ_BLOCK_SIZE (64 * 1024)		// Bytes requested from the stream per read. Lines may be longer than a block.
+#endif
+
+#ifndef TINY_YAML_WRITE_BLOCK_SIZE
+#define TINY_YAML_WRITE_BLOCK_SIZE (256 * 1024)	// Bytes gathered by a Writer before they are written to the stream.
+#endif
+
+#ifndef TINY_YAML_PARALLEL_CHUNK_SIZE
+#define TINY_YAML_PARALLEL_CHUNK_SIZE (1024 * 1024)	// Smallest part of a document given to one worker by a parallel load.
+#endif
+
+#ifndef TINY_YAML_KEY_POOL_SIZE
+#define TINY_YAML_KEY_POOL_SIZE (64 * 1024)		// Distinct keys interned per document, the following ones are copied without pooling.
+#endif
+
+#ifndef TINY_YAML_STATS
+#define TINY_YAML_STATS 0							// 1 to collect LoadStats while loading (see Yaml::getStats). At 0 no counting code is compiled.
+#endif
 
 
 #include <memory>
+#include <memory_resource>
 #include <string>
+#include <string_view>
 #include <unordered_map>
-#include <iostream>
+#include <vector>
+#include <stack>
+#include <atomic>
+#include <mutex>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <tuple>
+#include <optional>
+#include <limits>
+#include <utility>
+#include <istream>
+#include <ostream>
+#include <fstream>
 
 namespace TINY_YAML {
 
+	template<typename F, typename S, typename T> struct Triple;
+	class Node;
+	class Yaml;
+	class Path;
+	class DocumentStream;
+	class LiveYaml;
+	class Writer;
+	struct LoadResult;
+	struct Change;
+
 	/// <summary>
-	/// If a node is a leaf => it has data. Otherwise, it has only children nodes.
+	/// Read-only memory mapping of a whole file. The mapping is released when the object is closed or destroyed.
 	/// </summary>
-	class Node {
+	class MappedFile {
 	private:
-		std::string m_identifier;														// name of the node
-		std::shared_ptr<void> m_data;													// Contains the data of the node
-		std::unordered_map<std::string, std::shared_ptr<Node>> m_children;				// Holds data to the children nodes
+		const char* m_data = nullptr;													// First byte of the mapping
+		std::size_t m_size = 0;															// Size of the mapping in bytes
+#if _WIN32
+		void* m_file = nullptr;															// File HANDLE
+		void* m_mapping = nullptr;														// File mapping HANDLE
+#endif
 
 	public:
+		MappedFile() = default;
+		~MappedFile();
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
 		/// <summary>
-		/// 
+		/// Maps the given file into memory (read-only). Any previous mapping is released first.
 		/// </summary>
-		/// <param name="identifier"></param>
-		/// <param name="data"></param>
-		/// <param name="size"></param>
-		Node(const std::string& identifier, std::shared_ptr<void> data);
-		~Node();
+		/// <param name="filepath">Path of the file to map</param>
+		/// <returns>False if the file can not be opened or mapped</returns>
+		bool open(const std::string& filepath);
 
 		/// <summary>
-		/// 
+		/// Releases the mapping (if any).
 		/// </summary>
-		/// <param name="node"></param>
-		/// <returns></returns>
-		bool append(std::shared_ptr<Node> node);
+		void close();
 
 		/// <summary>
-		/// 
 		/// </summary>
-		/// <returns></returns>
-		unsigned int getSize() {
-			return this->m_children.size();
+		/// <returns>The mapped bytes. Valid until the mapping is closed.</returns>
+		std::string_view view() const {
+			return std::string_view(m_data, m_size);
 		}
+	};
+
+
+	/// <summary>
+	/// Splits a stream into lines without any limit on the line length.
+	/// The stream is read in big blocks into one reusable buffer; the buffer only grows when a single line does not fit in it.
+	/// </summary>
+	class LineReader {
+	private:
+		std::istream& m_stream;															// Stream being read
+		std::vector<char> m_buffer;														// Reused read buffer
+		std::size_t m_begin = 0;														// First byte not returned yet
+		std::size_t m_end = 0;															// End of the bytes read into the buffer
+		std::size_t m_scanned = 0;														// Bytes after m_begin already known not to contain '\n'
+		bool m_eof = false;																// The stream has no more data
 
+		bool fill();
+
+	public:
 		/// <summary>
-		/// 
 		/// </summary>
-		/// <param name="result"></param>
-		/// <returns></returns>
-		std::string& getID();
+		/// <param name="stream">Stream to read, it must outlive the reader</param>
+		/// <param name="blockSize">Bytes requested from the stream per read</param>
+		LineReader(std::istream& stream, std::size_t blockSize = TINY_YAML_READ_BLOCK_SIZE);
 
 		/// <summary>
-		/// 
+		/// Reads the next line (without its '\n').
 		/// </summary>
-		/// <typeparam name="T"></typeparam>
-		/// <param name=""></param>
-		/// <returns></returns>
-		template<typename T> T& getData() {
-			return *std::static_pointer_cast<T>(m_data);
+		/// <param name="line">View of the line, valid until the next call</param>
+		/// <returns>False when the stream is exhausted</returns>
+		bool next(std::string_view& line);
+	};
+
+
+	/// <summary>
+	/// Gathers the output in one reusable buffer and writes it to the stream in big blocks.
+	/// </summary>
+	class Writer {
+	private:
+		std::ostream& m_stream;															// Stream written to
+		std::vector<char> m_buffer;														// Reused write buffer
+		std::size_t m_size = 0;															// Bytes waiting in the buffer
+
+	public:
+		/// <summary>
+		/// </summary>
+		/// <param name="stream">Stream to write, it must outlive the writer</param>
+		/// <param name="blockSize">Bytes gathered before they are written</param>
+		Writer(std::ostream& stream, std::size_t blockSize = TINY_YAML_WRITE_BLOCK_SIZE);
+		~Writer();
+		Writer(const Writer&) = delete;
+		Writer& operator=(const Writer&) = delete;
+
+		void write(std::string_view text);
+		void put(char c) {
+			if (this->m_size == this->m_buffer.size())
+				flush();
+			this->m_buffer[this->m_size++] = c;
 		}
+		void indent(std::size_t columns);
 
-		
 		/// <summary>
-		/// 
 		/// </summary>
-		friend std::ostream& operator<<(std::ostream& os, const Node& node) {
-			os << node.m_identifier << " (" << &node << ")" << std::endl;
-			for (const auto& it : node.m_children) {
-				os << node.m_identifier << " : " << *it.second;
-			}
-			return os;
+		/// <returns>False once the stream failed (the buffered bytes are not written yet)</returns>
+		bool good() const {
+			return static_cast<bool>(this->m_stream);
 		}
 
 		/// <summary>
-		/// 
+		/// Writes the buffered bytes to the stream.
 		/// </summary>
-		Node& operator[](const std::string& identifier) {
-			return *m_children[identifier];
+		/// <returns>False if the stream failed</returns>
+		bool flush();
+	};
+
+
+	/// <summary>
+	/// Bump allocator owning everything a Yaml object builds while loading: nodes, their containers and the copied keys/values.
+	/// Allocations are never freed one by one; clear() runs the registered destructors and releases all the blocks in one shot.
+	/// </summary>
+	class Arena : public std::pmr::memory_resource {
+	private:
+		struct Cleanup {
+			void* object;
+			void (*destroy)(void*);
+		};
+
+		struct Block {
+			std::unique_ptr<char[]> data;
+			std::size_t size;
+		};
+
+		struct Range {
+			const char* begin;
+			const char* end;
+		};
+
+		std::vector<Block> m_blocks;													// Allocated blocks, the last one is the current block
+		std::vector<Range> m_ranges;													// The blocks sorted by address, searched by contains()
+		char* m_cursor = nullptr;														// Next free byte in the current block
+		char* m_end = nullptr;															// End of the current block
+		std::size_t m_nextBlockSize = 64 * 1024;										// Size of the next block, doubled up to 4 MiB
+		std::size_t m_reserved = 0;														// Total bytes of all blocks
+		std::vector<Cleanup> m_cleanups;												// Destructors of the non-trivial objects created in the arena
+
+		void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+		void do_deallocate(void*, std::size_t, std::size_t) override {}					// Memory is only released by clear()
+		bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+			return this == &other;
 		}
 
+	public:
+		Arena() = default;
+		~Arena();
+		Arena(const Arena&) = delete;
+		Arena& operator=(const Arena&) = delete;
+
 		/// <summary>
-		/// 
+		/// Constructs an object inside the arena. Its destructor is called by clear().
 		/// </summary>
-		/// <param name="data"></param>
-		/// <returns></returns>
-		bool setData(std::shared_ptr<void> data) {
-			this->m_data = data;
-			return true;
+		template<typename T, typename... Args> T* create(Args&&... args) {
+			T* object = new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+			if constexpr (!std::is_trivially_destructible_v<T>)
+				this->m_cleanups.push_back({ object, [](void* p) { static_cast<T*>(p)->~T(); } });
+			return object;
 		}
 
+		/// <summary>
+		/// Copies the text into the arena.
+		/// </summary>
+		/// <returns>View of the copy, valid until clear()</returns>
+		std::string_view store(std::string_view text);
+
+		/// <summary>
+		/// Destroys every object created in the arena and releases all the blocks.
+		/// </summary>
+		void clear();
+
+		/// <summary>
+		/// Destroys every object created in the arena but keeps the current block, so the next allocations reuse it.
+		/// </summary>
+		void rewind();
+
+		/// <summary>
+		/// </summary>
+		/// <returns>Whether the address is inside one of the blocks of the arena (binary search over the blocks)</returns>
+		bool contains(const void* address) const;
+
+		/// <summary>
+		/// </summary>
+		/// <returns>Total bytes reserved from the system</returns>
+		std::size_t reserved() const {
+			return this->m_reserved;
+		}
 	};
 
 
-	class Yaml {
-		std::unordered_map<std::string, std::shared_ptr<Node>> m_roots;			// The root nodes in the file.
+	/// <summary>
+	/// Keys of a document copied once into its arena: every occurrence of a key points to the same copy, so its data pointer identifies it.
+	/// Used when the text does not outlive the load (streams). Past TINY_YAML_KEY_POOL_SIZE distinct keys, new keys are copied without pooling,
+	/// documents with millions of unique keys do not pay for the table.
+	/// </summary>
+	class KeyPool {
+	private:
+		std::vector<std::string_view> m_slots;											// Open addressing, an empty slot has no data
+		std::size_t m_count = 0;														// Keys held
+
+		void grow();
+
 	public:
-		Yaml(const std::string& filepath);		
-		~Yaml();
+		/// <summary>
+		/// </summary>
+		/// <returns>The pooled copy of the key, made in the arena the first time the key is seen</returns>
+		std::string_view intern(std::string_view key, Arena& arena);
 
-		bool load(const std::string& filepath);									// Loads data from a specific file
-		// bool save(const std::string& filepath);								// Saves data too a specific file, For future release..
-	
-		friend std::ostream& operator<<(std::ostream& os, Yaml& yaml) {
-			for (const auto& it: yaml.m_roots) {
-				os << *it.second;
+		/// <summary>
+		/// </summary>
+		/// <returns>The pooled copy, an empty view without data if the key is not pooled</returns>
+		std::string_view find(std::string_view key) const;
+
+		/// <summary>
+		/// Forgets every key (their copies stay in the arena).
+		/// </summary>
+		void clear();
+
+		std::size_t size() const {
+			return this->m_count;
+		}
+	};
+
+
+	/// <summary>
+	/// Options of Yaml::load/loadMapped.
+	/// </summary>
+	struct LoadOptions {
+		bool resolveScalars = false;													// Resolve every scalar into a typed Value while loading
+		unsigned int threads = 1;														// Workers parsing the document, split at its top-level keys (0 for std::thread::hardware_concurrency())
+		bool lazy = false;																// Parse the content of a root key the first time it is reached (load, loadMapped and parse)
+	};
+
+
+	/// <summary>
+	/// Why a load failed. Filled without any allocation: the message is a static description of the code.
+	/// </summary>
+	struct ParseError {
+		enum class Code : std::uint8_t {
+			None,																		// The load succeeded
+			CannotOpen,																	// The file can not be opened
+			CannotMap,																	// The file can not be mapped
+			UnclosedQuote,																// A quote is not closed on its line
+			MissingColon,																// A line that is neither a key nor a list item
+			MisplacedDash,																// A list item where no sequence can be
+			DuplicateKey,																// A key already found in the same mapping
+			MixedCollection,															// A key among the items of a sequence
+			InvalidFlow,																// A flow collection (`[a, b]`, `{a: 1}`) that is not closed on its line or is malformed
+			InvalidJson,																// parseJson(): invalid json syntax
+			InvalidImage,																// loadBinary(): not a binary yaml image (or not the one of the yaml file)
+			OutOfMemory,																// An allocation failed while parsing
+			UnexpectedException															// Another exception stopped the load (e.g. a thread or a file system error)
+		};
+
+		Code code = Code::None;
+		unsigned int line = 0;															// 1 based, 0 if the error is not about a line
+		unsigned int column = 0;														// 1 based, 0 if the error is not about a line
+		std::string_view message;														// Static description of the code (empty for Code::None)
+
+		bool ok() const {
+			return this->code == Code::None;
+		}
+
+		/// <summary>
+		/// </summary>
+		/// <returns>Static description of the code</returns>
+		static std::string_view describe(Code code) {
+			switch (code) {
+			case Code::None: return std::string_view();
+			case Code::CannotOpen: return "file cannot be opened";
+			case Code::CannotMap: return "file cannot be mapped";
+			case Code::UnclosedQuote: return "unclosed quote";
+			case Code::MissingColon: return "line is neither a key nor a list item";
+			case Code::MisplacedDash: return "list item outside of a sequence";
+			case Code::DuplicateKey: return "duplicated key";
+			case Code::MixedCollection: return "key inside a sequence";
+			case Code::InvalidFlow: return "invalid flow collection";
+			case Code::InvalidJson: return "invalid json syntax";
+			case Code::InvalidImage: return "invalid binary yaml image";
+			case Code::OutOfMemory: return "out of memory";
+			case Code::UnexpectedException: return "unexpected exception while loading";
 			}
-			os << std::endl;
-			return os;
+			return std::string_view();
+		}
+	};
+
+
+	/// <summary>
+	/// Thrown by the constructors loading a file and by the lazy parsing of a node, carries the structured error.
+	/// </summary>
+	class ParseException : public std::runtime_error {
+	private:
+		ParseError m_error;
+
+	public:
+		ParseException(const std::string& what, const ParseError& error)
+		: std::runtime_error(what), m_error(error)
+		{}
+
+		const ParseError& error() const {
+			return this->m_error;
+		}
+	};
+
+
+	/// <summary>
+	/// What the last load of a Yaml object did and where its time went. Only filled when the library is built with TINY_YAML_STATS=1,
+	/// otherwise every field stays 0. The lines parsed later by a lazy load are added when they are parsed.
+	/// The phase times of a parallel load are summed over the workers, they can exceed totalSeconds.
+	/// </summary>
+	struct LoadStats {
+		struct Event {
+			const char* name;															// "load", "chunk" (one worker of a parallel load) or "materialize" (one lazy root)
+			std::uint32_t thread;														// Worker index, 0 for the calling thread
+			double start;																// Microseconds since the load started
+			double duration;															// Microseconds
+		};
+
+		std::uint64_t bytesRead = 0;													// Bytes of yaml text consumed
+		std::uint64_t lines = 0;														// Lines parsed
+		std::uint64_t nodes = 0;														// Nodes created
+		std::uint64_t allocations = 0;													// Arena allocations (nodes, child lists, copied text)
+		std::uint64_t bytesAllocated = 0;												// Bytes requested from the arenas
+		std::uint64_t bytesReserved = 0;												// Bytes the arenas of the document hold from the system
+		std::uint32_t maxDepth = 0;														// Deepest nesting of parents
+		double readSeconds = 0;															// Reading the stream (or the whole file before a parallel/lazy load)
+		double scanSeconds = 0;															// Splitting the lines into key, value and marks
+		double buildSeconds = 0;														// Creating the nodes and inserting them into their parents
+		double totalSeconds = 0;														// Whole load call
+		std::vector<Event> events;														// Spans of the load, its workers and its lazy parses
+
+		/// <summary>
+		/// Adds the counters and the events of a worker. The larger depth is kept, totalSeconds is left alone.
+		/// </summary>
+		void merge(const LoadStats& other);
+
+		/// <summary>
+		/// Writes the events in the Chrome trace event format (chrome://tracing, Perfetto). The counters are the arguments of the "load" event.
+		/// </summary>
+		void writeTrace(std::ostream& stream) const;
+	};
+
+
+	/// <summary>
+	/// Scalar value of a node: the raw text plus, once resolved, its type and its converted value (null/bool/int64/double/string).
+	/// Resolved values are converted only once; unresolved values are converted on every as<T>() call.
+	/// </summary>
+	class Value {
+		friend class Yaml;
+	public:
+		enum class Type : std::uint8_t {
+			Raw,																		// Not resolved yet
+			Null,																		// ~, null, Null, NULL or nothing
+			Bool,																		// true/false (also True, TRUE, False, FALSE)
+			Int,																		// Decimal, 0x hexadecimal or 0o octal
+			Double,																		// Decimal/exponent notation, .inf, .nan
+			String																		// Anything else. Quotes are removed.
+		};
+
+	private:
+		std::string_view m_text;														// Raw text as written in the document
+		union {
+			bool m_bool;
+			std::int64_t m_int;
+			double m_double;
+			struct {
+				const char* data;
+				std::size_t size;
+			} m_string;																	// String content (without the quotes)
+		};
+		Type m_type = Type::Raw;
+
+		bool toBool() const;
+		std::int64_t toInt() const;
+		double toDouble() const;
+		std::string_view toString() const;
+		[[noreturn]] void outOfRange() const;
+
+	public:
+		Value() : m_int(0) {}
+		explicit Value(std::string_view text) : m_text(text), m_int(0) {}
+
+		/// <summary>
+		/// Resolves the type of the text and converts it.
+		/// </summary>
+		/// <param name="text">Raw scalar text</param>
+		/// <param name="arena">Receives the unescaped content of double quoted strings that contain escapes</param>
+		static Value resolve(std::string_view text, Arena& arena);
+
+		/// <summary>
+		/// </summary>
+		/// <returns>True if the text is a quoted scalar ("..." or '...')</returns>
+		static bool isQuoted(std::string_view text) {
+			return text.size() >= 2 && (text[0] == '"' || text[0] == '\'') && text.back() == text[0];
+		}
+
+		/// <summary>
+		/// Content of a quoted text (unescaped into the arena if it has escapes), the text itself if it is not quoted.
+		/// </summary>
+		static std::string_view unquote(std::string_view text, Arena& arena) {
+			return isQuoted(text) ? resolve(text, arena).as<std::string_view>() : text;
+		}
+
+		/// <summary>
+		/// </summary>
+		/// <returns>Type of the value, Raw if it is not resolved</returns>
+		Type type() const {
+			return this->m_type;
+		}
+
+		/// <summary>
+		/// </summary>
+		/// <returns>Raw text as written in the document</returns>
+		std::string_view text() const {
+			return this->m_text;
+		}
+
+		/// <summary>
+		/// Typed access. Allocation-free; O(1) when resolved. Throws std::runtime_error if the value can not be converted to T
+		/// or if an integer does not fit into T. Supported types: bool, integral types, floating point types and std::string_view.
+		/// An unresolved std::string_view drops the quotes of the raw text; double quoted text with escapes throws, as unescaping it
+		/// needs an arena (see resolve and unquote).
+		/// </summary>
+		template<typename T> T as() const {
+			if constexpr (std::is_same_v<T, bool>)
+				return (this->m_type == Type::Bool) ? this->m_bool : toBool();
+			else if constexpr (std::is_integral_v<T>) {
+				std::int64_t number = (this->m_type == Type::Int) ? this->m_int : toInt();
+				if constexpr (std::is_unsigned_v<T>) {
+					if (number < 0 || static_cast<std::uint64_t>(number) > std::numeric_limits<T>::max())
+						outOfRange();
+				}
+				else if (number < std::numeric_limits<T>::min() || number > std::numeric_limits<T>::max())
+					outOfRange();
+				return static_cast<T>(number);
+			}
+			else if constexpr (std::is_floating_point_v<T>)
+				return static_cast<T>((this->m_type == Type::Double) ? this->m_double : toDouble());
+			else {
+				static_assert(std::is_same_v<T, std::string_view>, "Value::as<T>() supports bool, integral, floating point and std::string_view types");
+				return (this->m_type == Type::String) ? std::string_view(this->m_string.data, this->m_string.size) : toString();
+			}
+		}
+
+		/// <summary>
+		/// </summary>
+		/// <returns>True if the value is null</returns>
+		bool isNull() const;
+	};
+
+
+	/// <summary>
+	/// Children of a node in document order, in one flat array.
+	/// The first entries live inside the object, bigger lists move to the arena. Small lists are searched linearly;
+	/// past LINEAR_LIMIT entries an open-addressing hash index (positions into the array) is kept next to them.
+	/// </summary>
+	class ChildList {
+	public:
+		struct Entry {
+			std::string_view key;
+			Node* node;
+		};
+
+		static constexpr std::uint32_t INLINE_CAPACITY = 2;								// Entries stored inside the object
+		static constexpr std::uint32_t LINEAR_LIMIT = 8;									// Biggest list searched without the index
+
+	private:
+		Entry* m_entries;																// m_inline or an arena array
+		std::uint32_t m_size = 0;
+		std::uint32_t m_capacity = INLINE_CAPACITY;
+		std::uint32_t* m_index = nullptr;												// Hash slots holding position + 1 (0 = empty)
+		std::uint32_t m_indexMask = 0;													// Number of slots - 1
+		std::pmr::memory_resource* m_resource;											// Arena the arrays are allocated from
+		Entry m_inline[INLINE_CAPACITY];
+
+		void rebuildIndex();
+
+		/// Interned keys are the same pointer, the characters are compared only for the others
+		static bool sameKey(std::string_view a, std::string_view b) {
+			return a.size() == b.size() && (a.data() == b.data() || std::memcmp(a.data(), b.data(), a.size()) == 0);
+		}
+
+	public:
+		explicit ChildList(std::pmr::memory_resource* resource)
+		: m_entries(m_inline), m_resource(resource)
+		{}
+		ChildList(const ChildList&) = delete;
+		ChildList& operator=(const ChildList&) = delete;
+
+		/// <summary>
+		/// Adds the node at the end of the list.
+		/// </summary>
+		/// <returns>False (and nothing is added) if a child with the same key exists already</returns>
+		bool append(std::string_view key, Node* node);
+
+		/// <summary>
+		/// Adds the node at the end of the list without any key (sequence items).
+		/// </summary>
+		void push(Node* node);
+
+		/// <summary>
+		/// Makes room for the given number of entries, so a list whose size is known grows only once.
+		/// </summary>
+		void reserve(std::uint32_t capacity);
+
+		/// <summary>
+		/// Looks up a child without any allocation.
+		/// </summary>
+		/// <returns>The child, nullptr if there is none with this key</returns>
+		Node* find(std::string_view key) const;
+
+		std::uint32_t size() const {
+			return this->m_size;
+		}
+
+		Node* at(std::size_t index) const {
+			return (index < this->m_size) ? this->m_entries[index].node : nullptr;
+		}
+
+		/// <summary>
+		/// Puts another node at the given position, the key does not change.
+		/// </summary>
+		void replace(std::size_t index, Node* node) {
+			this->m_entries[index].node = node;
+		}
+
+		const Entry* begin() const {
+			return this->m_entries;
+		}
+
+		const Entry* end() const {
+			return this->m_entries + this->m_size;
+		}
+
+		std::pmr::memory_resource* resource() const {
+			return this->m_resource;
+		}
+	};
+
+
+	/// <summary>
+	/// Iterates over the children of a node as Node references.
+	/// </summary>
+	class NodeIterator {
+	private:
+		const ChildList::Entry* m_entry;
+
+	public:
+		explicit NodeIterator(const ChildList::Entry* entry) : m_entry(entry) {}
+		Node& operator*() const { return *this->m_entry->node; }
+		Node* operator->() const { return this->m_entry->node; }
+		NodeIterator& operator++() { this->m_entry++; return *this; }
+		bool operator==(const NodeIterator& other) const { return this->m_entry == other.m_entry; }
+		bool operator!=(const NodeIterator& other) const { return this->m_entry != other.m_entry; }
+	};
+
+
+	/// <summary>
+	/// Content of a root key not parsed yet (lazy loading): the text of its lines, parsed into the node the first time it is reached.
+	/// </summary>
+	struct LazyBlock {
+		std::string_view text;															// Lines after the key, up to the next root key
+		unsigned int line;																// Line of the key
+		Yaml* yaml;																		// Document owning the node
+		ParseError failure;																// Syntax error found while parsing the text (Code::None if none)
+		std::atomic<bool> done{ false };												// The text is parsed
+
+		LazyBlock(std::string_view text, unsigned int line, Yaml* yaml)
+		: text(text), line(line), yaml(yaml)
+		{}
+	};
+
+
+	/// <summary>
+	/// If a node is a leaf => it has data. Otherwise, it has only children nodes:
+	/// keyed children (a mapping) or items addressed by their index (a sequence, e.g. `- item`). The items of a sequence have no identifier.
+	/// The identifier and the value are views into the text owned by the Yaml object that created the node. The identifier is stored
+	/// without its quotes (unescaped into the arena if it has escapes), the value as written.
+	/// </summary>
+	class Node {
+		friend class Yaml;
+		friend std::ostream& operator<<(std::ostream& os, Yaml& yaml);
+	public:
+		enum class Kind : std::uint8_t {
+			Scalar,																		// A value (or nothing)
+			Mapping,																	// Keyed children
+			Sequence																	// Indexed items
+		};
+
+	private:
+		std::string_view m_identifier;													// name of the node
+		Value m_value;																	// Scalar value of the node (empty if it has none)
+		Kind m_kind = Kind::Scalar;														// Decided by the first child
+		void* m_data = nullptr;															// Data materialized on demand by getData<T>(), created in the arena
+		ChildList m_children;															// Holds data to the children nodes (or the sequence items)
+		LazyBlock* m_lazy = nullptr;													// Content still to parse (lazy loading)
+
+		/// <summary>
+		/// Parses the lazy content of the node (once, even with concurrent readers). Throws ParseException if it is invalid.
+		/// </summary>
+		void expand() const {
+			if (this->m_lazy != nullptr && !(this->m_lazy->done.load(std::memory_order_acquire) && this->m_lazy->failure.ok()))
+				materialize();
+		}
+		void materialize() const;
+
+	public:
+		/// <summary>
+		/// 
+		/// </summary>
+		/// <param name="identifier">Name of the node</param>
+		/// <param name="value">Scalar value of the node</param>
+		/// <param name="arena">Arena holding the node, its containers allocate from it too</param>
+		Node(std::string_view identifier, std::string_view value, Arena& arena);
+
+		/// <summary>
+		/// Adds a keyed child, the node becomes a mapping.
+		/// </summary>
+		/// <param name="node"></param>
+		/// <returns>False if the key exists already or the node is a sequence</returns>
+		bool append(Node* node);
+
+		/// <summary>
+		/// Adds an item at the end, the node becomes a sequence.
+		/// </summary>
+		/// <param name="node"></param>
+		/// <returns>False if the node is a mapping</returns>
+		bool push(Node* node);
+
+		/// <summary>
+		/// </summary>
+		/// <returns>Number of children (mapping) or items (sequence)</returns>
+		unsigned int getSize() const {
+			expand();
+			return this->m_children.size();
+		}
+
+		/// <summary>
+		/// </summary>
+		/// <returns></returns>
+		Kind getKind() const {
+			expand();
+			return this->m_kind;
+		}
+
+		/// <summary>
+		/// 
+		/// </summary>
+		/// <param name="result"></param>
+		/// <returns></returns>
+		std::string_view getID() const;
+
+		/// <summary>
+		/// Zero-copy access to the scalar value of the node.
+		/// </summary>
+		/// <returns>View into the text owned by the Yaml object</returns>
+		std::string_view getValue() const {
+			return this->m_value.text();
+		}
+
+		/// <summary>
+		/// Typed scalar value of the node (resolved during loading when LoadOptions::resolveScalars is set).
+		/// </summary>
+		/// <returns></returns>
+		const Value& getScalar() const {
+			return this->m_value;
+		}
+
+		/// <summary>
+		/// Shortcut of getScalar().as<T>().
+		/// </summary>
+		template<typename T> T as() const {
+			return this->m_value.template as<T>();
+		}
+
+		/// <summary>
+		/// Supported types: std::string (the value) and std::vector<std::string> (the values of the sequence items).
+		/// The data is copied out of the document on the first call and cached in the node: unlike the const members,
+		/// this one must not be called while other threads read the node.
+		/// </summary>
+		/// <typeparam name="T"></typeparam>
+		/// <param name=""></param>
+		/// <returns></returns>
+		template<typename T> T& getData();
+
+		
+		/// <summary>
+		/// 
+		/// </summary>
+		friend std::ostream& operator<<(std::ostream& os, const Node& node) {
+			node.expand();
+			os << node.m_identifier << " (" << &node << ")" << std::endl;
+			for (const auto& it : node.m_children) {
+				os << node.m_identifier << " : " << *it.node;
+			}
+			return os;
+		}
+
+		/// <summary>
+		/// Looks up a child by key. On a sequence the key is the decimal index of the item (e.g. "0"). Never modifies the tree.
+		/// </summary>
+		/// <returns>The child, nullptr if it does not exist</returns>
+		const Node* find(std::string_view identifier) const;
+
+		Node* find(std::string_view identifier) {
+			return const_cast<Node*>(static_cast<const Node*>(this)->find(identifier));
+		}
+
+		/// <summary>
+		/// Throws std::out_of_range if the child does not exist.
+		/// </summary>
+		const Node& at(std::string_view identifier) const {
+			const Node* child = find(identifier);
+			if (child == nullptr)
+				throw std::out_of_range("ERROR: Yaml node has no child named " + std::string(identifier));
+			return *child;
+		}
+
+		Node& at(std::string_view identifier) {
+			return const_cast<Node&>(static_cast<const Node*>(this)->at(identifier));
+		}
+
+		/// <summary>
+		/// O(1) access to the items of a sequence. Throws std::out_of_range if the item does not exist.
+		/// </summary>
+		const Node& at(std::size_t index) const {
+			expand();
+			const Node* item = (this->m_kind == Kind::Sequence) ? this->m_children.at(index) : nullptr;
+			if (item == nullptr)
+				throw std::out_of_range("ERROR: Yaml node has no item " + std::to_string(index));
+			return *item;
+		}
+
+		Node& at(std::size_t index) {
+			return const_cast<Node&>(static_cast<const Node*>(this)->at(index));
+		}
+
+		/// <summary>
+		/// Same as at().
+		/// </summary>
+		const Node& operator[](std::string_view identifier) const {
+			return at(identifier);
+		}
+
+		Node& operator[](std::string_view identifier) {
+			return at(identifier);
+		}
+
+		const Node& operator[](std::size_t index) const {
+			return at(index);
+		}
+
+		Node& operator[](std::size_t index) {
+			return at(index);
+		}
+
+		/// <summary>
+		/// Value of a child converted to T (see Value::as), without any exception.
+		/// </summary>
+		/// <returns>The value, std::nullopt if the child does not exist, can not be converted, does not fit into T
+		/// or sits in a lazy block that fails to parse</returns>
+		template<typename T> std::optional<T> getIf(std::string_view identifier) const {
+			try {
+				/*find() expands lazy blocks, which throws ParseException on broken input*/
+				const Node* child = find(identifier);
+				if (child == nullptr)
+					return std::nullopt;
+				return child->as<T>();
+			}
+			catch (const std::runtime_error&) {
+				return std::nullopt;
+			}
+		}
+
+		/// <summary>
+		/// Range iteration over the children (mapping) or the items (sequence), in document order.
+		/// </summary>
+		NodeIterator begin() const {
+			expand();
+			return NodeIterator(this->m_children.begin());
+		}
+
+		NodeIterator end() const {
+			expand();
+			return NodeIterator(this->m_children.end());
+		}
+
+		/// <summary>
+		/// Children of the node in document order.
+		/// </summary>
+		/// <returns></returns>
+		const ChildList& getChildren() const {
+			expand();
+			return this->m_children;
+		}
+
+	};
+
+	template<> std::string& Node::getData<std::string>();
+	template<> std::vector<std::string>& Node::getData<std::vector<std::string>>();
+
+	static_assert(std::is_trivially_destructible_v<Node>, "Nodes are released with their arena, without any cleanup entry");
+
+
+	/// <summary>
+	/// A parsed document. Once loaded, every const member (and the const members of its nodes) can be called by many threads at once:
+	/// lookups never modify the tree, and the lazy roots are parsed once under a lock. Loading again, Node::getData() and LiveYaml::reload()
+	/// modify the document and must not overlap with readers.
+	/// </summary>
+	class Yaml {
+		MappedFile m_mapping;														// File mapped by loadMapped(), the nodes point into it.
+		std::shared_ptr<Arena> m_arena;												// Holds all the nodes, and the keys/values copied by load(). Shared with the later snapshots reusing its nodes (LiveYaml)
+		std::vector<std::shared_ptr<Arena>> m_borrowed;								// Arenas of older snapshots holding the nodes reused by this one
+		std::vector<std::unique_ptr<Arena>> m_chunkArenas;							// Hold the nodes built by the extra workers of a parallel load
+		Node* m_roots = nullptr;													// Virtual node holding the root nodes in the file.
+		bool m_copyText = true;														// Whether keys/values must be copied into the arena (the text does not outlive the line)
+		LoadOptions m_options;														// Options of the current load
+		std::uint64_t m_generation = 0;												// Incremented whenever the nodes are released, invalidates the compiled paths
+		std::string m_error;														// Why the last load failed (empty if it succeeded)
+		ParseError m_failure;														// Same, structured
+		mutable std::mutex m_lazyMutex;												// Serializes the lazy parsing (it allocates from the arena)
+		KeyPool m_keys;																// Keys copied by a stream load, one copy per distinct key
+		LoadStats m_stats;															// Stats of the last load (TINY_YAML_STATS)
+		std::chrono::steady_clock::time_point m_statsEpoch;							// Start of the last load, origin of the stats events
+
+		friend class Path;
+		friend class Node;
+		friend class DocumentStream;
+		friend class LiveYaml;
+
+		void reset();
+		bool parseLine(std::string_view lineContent, Node* roots, Arena& arena, std::stack<Triple<Node*, unsigned int, bool>>& parentsStack);
+		bool parseFlow(std::string_view text, std::size_t column, Node* node, Arena& arena);
+		bool parseLines(std::string_view content, Node* roots, Arena& arena, std::stack<Triple<Node*, unsigned int, bool>>& parentsStack, unsigned int& line);
+		bool parseChunk(std::string_view content, Node* roots, Arena& arena, unsigned int& line);
+		bool parseContent(std::string_view content, unsigned int& line);
+		bool parseLazy(std::string_view content, unsigned int& line);
+		static bool same(const Node& a, const Node& b);
+		void reuse(Node& fresh, Node& old, std::string& path, std::vector<Change>& changes, std::vector<Node*>& reused);
+		void borrow(const Yaml& old, const std::vector<Node*>& reused);
+		bool writeImage(const std::string& filepath, std::uint64_t sourceSize, std::int64_t sourceTime);
+		bool readImage(const std::string& filepath, std::uint64_t sourceSize, std::int64_t sourceTime);
+		bool parseJsonValue(Node* node, std::string_view text, std::size_t& pos, unsigned int depth);
+		static void emitChildren(const Node& node, std::size_t indent, Writer& writer);
+		static void emitEntry(std::string_view key, const Node& node, std::size_t indent, Writer& writer);
+		bool fail(unsigned int line);
+		bool fail(ParseError::Code code, const std::string& error);
+
+	public:
+		Yaml();
+		Yaml(const std::string& filepath, const LoadOptions& options = LoadOptions());		// Throws ParseException if the file can not be loaded
+		~Yaml();
+		Yaml(const Yaml&) = delete;
+		Yaml& operator=(const Yaml&) = delete;
+
+		bool load(const std::string& filepath, const LoadOptions& options = LoadOptions());			// Loads data from a specific file
+		bool load(std::istream& stream, const LoadOptions& options = LoadOptions());				// Loads data from any stream (read until its end). Keys and values are copied.
+		bool parse(std::string_view text, const LoadOptions& options = LoadOptions());				// Parses a document in memory in place. Keys and values point into the text, it must outlive the object.
+		bool parseJson(std::string_view text, const LoadOptions& options = LoadOptions());			// Parses a JSON object in place into the same tree. Strings keep their quotes as values, like double quoted yaml.
+		bool loadMapped(const std::string& filepath, const LoadOptions& options = LoadOptions());	// Maps the file into memory and parses it in place. Keys and values point into the mapping.
+		bool saveBinary(const std::string& filepath);												// Writes the tree as a binary image, see loadBinary()
+		bool loadBinary(const std::string& filepath);												// Maps a binary image and rebuilds the tree from it without parsing. Keys and values point into the mapping.
+		bool loadCached(const std::string& filepath, const LoadOptions& options = LoadOptions());	// loadBinary() of the `<filepath>.tyc` image if it matches the file (size, time, options), otherwise load() and write the image
+		bool save(const std::string& filepath);														// Writes the tree to a file (block style)
+		bool save(std::ostream& stream);															// Writes the tree to a stream (block style)
+		void save(Writer& writer);																	// Writes the tree through a writer, whose buffer can serve many documents
+
+		/// <summary>
+		/// Loads many files concurrently. Every worker starts on its own slice of the files and steals from the other slices once its own is done,
+		/// so a few slow files do not hold the whole batch back.
+		/// </summary>
+		/// <param name="filepaths">Files to load</param>
+		/// <param name="threads">Number of workers (the calling thread is one of them), 0 for std::thread::hardware_concurrency()</param>
+		/// <param name="options">Options used for every file</param>
+		/// <returns>One result per file, in the order of filepaths</returns>
+		static std::vector<LoadResult> loadMany(const std::vector<std::string>& filepaths, unsigned int threads = 0, const LoadOptions& options = LoadOptions());
+
+		/// <summary>
+		/// </summary>
+		/// <returns>Why the last load failed, empty if it succeeded</returns>
+		const std::string& getError() const {
+			return this->m_error;
+		}
+
+		/// <summary>
+		/// load() that never throws. Like every load, it writes nothing to any stream: meant for checking many files at once.
+		/// After an exception (OutOfMemory, UnexpectedException) the tree is left as the load made it and getError() is not updated.
+		/// </summary>
+		/// <returns>Why the load failed, ParseError::Code::None if it succeeded</returns>
+		ParseError tryLoad(const std::string& filepath, const LoadOptions& options = LoadOptions()) noexcept;
+
+		/// <summary>
+		/// </summary>
+		/// <returns>Why the last load (or parse) failed with its line and column, ParseError::Code::None if it succeeded</returns>
+		const ParseError& getParseError() const {
+			return this->m_failure;
+		}
+
+		/// <summary>
+		/// </summary>
+		/// <returns>Counters and timings of the last load, all 0 unless the library is built with TINY_YAML_STATS=1</returns>
+		LoadStats getStats() const;
+	
+		friend std::ostream& operator<<(std::ostream& os, Yaml& yaml) {
+			for (const auto& it: yaml.m_roots->m_children) {
+				os << *it.node;
+			}
+			os << std::endl;
+			return os;
+		}
+
+		Node& operator[](std::string_view identifier) {
+			return (*m_roots)[identifier];
+		}
+
+		const Node& operator[](std::string_view identifier) const {
+			return static_cast<const Node&>(*m_roots)[identifier];
+		}
+
+		/// <summary>
+		/// Pooled copy of a key of the document (see KeyPool). Lookups with it compare pointers instead of characters.
+		/// </summary>
+		/// <returns>The pooled key, the given key itself if it is not pooled (the document was not loaded from a stream, or has no such key)</returns>
+		std::string_view key(std::string_view identifier) const {
+			std::string_view pooled = this->m_keys.find(identifier);
+			return (pooled.data() != nullptr) ? pooled : identifier;
+		}
+
+		/// <summary>
+		/// Looks up a root key. Never modifies the document.
+		/// </summary>
+		/// <returns>The root node, nullptr if it does not exist</returns>
+		const Node* find(std::string_view identifier) const {
+			return static_cast<const Node*>(m_roots)->find(identifier);
+		}
+
+		/// <summary>
+		/// Throws std::out_of_range if the root key does not exist.
+		/// </summary>
+		const Node& at(std::string_view identifier) const {
+			return static_cast<const Node*>(m_roots)->at(identifier);
+		}
+
+		/// <summary>
+		/// Value of a root key converted to T, without any exception.
+		/// </summary>
+		/// <returns>The value, std::nullopt if the key does not exist or can not be converted (see Node::getIf)</returns>
+		template<typename T> std::optional<T> getIf(std::string_view identifier) const {
+			return static_cast<const Node*>(m_roots)->getIf<T>(identifier);
+		}
+
+		/// <summary>
+		/// Compiles a dot separated path (e.g. "node_list.1.extra") for repeated lookups.
+		/// </summary>
+		/// <returns>Handle resolving to the node, it must not outlive the Yaml object</returns>
+		Path compile(std::string_view path);
+
+		/// <summary>
+		/// Compiles a path given segment by segment (for keys containing dots).
+		/// </summary>
+		Path compile(const std::vector<std::string>& segments);
+	};
+
+
+	/// <summary>
+	/// Outcome of loading one file with Yaml::loadMany().
+	/// </summary>
+	struct LoadResult {
+		std::string filepath;															// File the result belongs to
+		std::unique_ptr<Yaml> yaml;														// Loaded document, nullptr if the load failed
+		std::string error;																// Why the load failed (empty on success)
+		ParseError failure;																// Same, structured
+
+		bool ok() const {
+			return this->yaml != nullptr;
+		}
+	};
+
+
+	/// <summary>
+	/// Reads a stream of `---` separated documents one at a time. Every document is parsed into the same Yaml object,
+	/// which reuses the memory of the previous document, so the cost per document stays the same over very long streams.
+	/// A document also ends at a `...` line. Text before the first `---` is a document only if it is not empty.
+	/// </summary>
+	class DocumentStream {
+	private:
+		std::ifstream m_file;															// Opened by the filepath constructor
+		LineReader m_reader;
+		unsigned int m_line = 0;														// Lines read so far
+		bool m_explicit = false;														// The last document ended at a `---`, which starts the next one
+		std::string m_error;															// Why the stream could not be opened
+		std::string m_text;																// Lines of the current document, gathered for a parallel or lazy parse
+
+	public:
+		/// <summary>
+		/// </summary>
+		/// <param name="stream">Stream to read, it must outlive the object</param>
+		explicit DocumentStream(std::istream& stream);
+
+		/// <summary>
+		/// </summary>
+		/// <param name="filepath">File to read, see getError() if it can not be opened</param>
+		explicit DocumentStream(const std::string& filepath);
+
+		/// <summary>
+		/// Parses the next document into the given object. An invalid document leaves the object empty with its error set
+		/// (document.getError()) and the following call goes on with the next document.
+		/// Every option applies: with several threads or lazy, the lines of the document are gathered first and parsed as with parse(),
+		/// otherwise they are parsed as they are read.
+		/// </summary>
+		/// <returns>False when the stream has no more documents</returns>
+		bool next(Yaml& document, const LoadOptions& options = LoadOptions());
+
+		/// <summary>
+		/// </summary>
+		/// <returns>Why the stream can not be read, empty if it can</returns>
+		const std::string& getError() const {
+			return this->m_error;
+		}
+	};
+
+
+	/// <summary>
+	/// Receives the events of an EventParser. Every view is only valid during the call.
+	/// The document itself is a mapping: its events start with startMapping() and finish with the matching end().
+	/// </summary>
+	class EventHandler {
+	public:
+		virtual ~EventHandler() = default;
+		virtual void startMapping() {}													// Keys and values follow, until end()
+		virtual void startSequence() {}													// Items follow, until end()
+		virtual void end() {}															// Closes the last started mapping or sequence
+		virtual void key(std::string_view key) { (void)key; }							// The next event is its value: a scalar or a start
+		virtual void scalar(std::string_view value) { (void)value; }					// Raw text (use Value(text).as<T>() to convert it), empty for a key without value
+		virtual bool stopped() const { return false; }									// True once the handler needs no more events: feeding a stream stops
+	};
+
+
+	/// <summary>
+	/// Push parser: the document is fed in chunks of any size and the events are emitted as soon as a line is complete. No node is built;
+	/// only the unfinished line and the open levels are kept, so the memory does not grow with the document.
+	/// Unlike Yaml, duplicated keys are not detected (nothing is remembered).
+	/// </summary>
+	class EventParser {
+	private:
+		struct Level {
+			std::size_t indent;															// Column of the key (or of the dash for sequence items)
+			bool item;																	// Mapping opened by a `- key: value` item
+			Node::Kind kind;															// Scalar while nothing is known about its content yet
+		};
+
+		EventHandler& m_handler;
+		std::string m_partial;															// Start of a line cut by the end of a chunk
+		std::vector<Level> m_levels;													// Open levels, the document mapping is not in there
+		bool m_started = false;															// Whether the document mapping is started
+		unsigned int m_line = 0;														// Lines parsed so far
+		std::string m_error;															// Why parsing stopped (empty while it goes on)
+		bool m_finished = false;														// finish() was called, the next feed() starts a new document
+
+		bool parseLine(std::string_view lineContent);
+		bool parseFlow(std::string_view text);											// Events of a flow collection (`[a, b]`, `{a: 1}`)
+		bool open(Node::Kind kind);
+		void close();
+		bool fail();
+
+	public:
+		/// <summary>
+		/// </summary>
+		/// <param name="handler">Receives the events, it must outlive the parser</param>
+		explicit EventParser(EventHandler& handler);
+
+		/// <summary>
+		/// Parses the complete lines of the chunk; the end of an unfinished line is kept for the next call.
+		/// </summary>
+		/// <returns>False once the document is invalid, see getError()</returns>
+		bool feed(std::string_view chunk);
+
+		/// <summary>
+		/// Feeds the whole stream, TINY_YAML_READ_BLOCK_SIZE bytes at a time. finish() is still to be called.
+		/// Reading stops early, after the current block, once the handler is stopped (see EventHandler::stopped).
+		/// </summary>
+		/// <returns>False once the document is invalid, see getError()</returns>
+		bool feed(std::istream& stream);
+
+		/// <summary>
+		/// Parses the last line and closes every open level. The parser is then ready for a new document.
+		/// </summary>
+		/// <returns>False if the document is invalid, see getError()</returns>
+		bool finish();
+
+		/// <summary>
+		/// </summary>
+		/// <returns>Why parsing stopped, empty if it did not</returns>
+		const std::string& getError() const {
+			return this->m_error;
+		}
+
+		/// <summary>
+		/// </summary>
+		/// <returns>Number of the line being parsed (the last complete line while events are emitted)</returns>
+		unsigned int getLine() const {
+			return this->m_line;
+		}
+	};
+
+
+	/// <summary>
+	/// Writes the events of an EventParser as compact JSON, so a yaml document is transcoded without building any node.
+	/// Scalars are resolved as with LoadOptions::resolveScalars: null, booleans and numbers are written bare, the rest as strings.
+	/// </summary>
+	class JsonWriter : public EventHandler {
+	private:
+		Writer& m_writer;
+		std::vector<char> m_closers;													// '}' or ']' of the open levels
+		bool m_comma = false;															// A value was written in the current level
+		bool m_afterKey = false;														// The next value belongs to the last key
+		Arena m_scratch;																// Unescaped strings of the current scalar
+
+		void separate();
+		void writeString(std::string_view text);
+
+	public:
+		/// <summary>
+		/// </summary>
+		/// <param name="writer">Receives the JSON, it must outlive the object</param>
+		explicit JsonWriter(Writer& writer);
+
+		void startMapping() override;
+		void startSequence() override;
+		void end() override;
+		void key(std::string_view key) override;
+		void scalar(std::string_view value) override;
+		bool stopped() const override;													// The JSON stream failed
+
+		/// <summary>
+		/// Transcodes a whole yaml stream into JSON. Reading stops as soon as the JSON can not be written.
+		/// </summary>
+		/// <param name="error">Why the yaml is invalid</param>
+		/// <returns>False if the yaml is invalid or the JSON can not be written</returns>
+		static bool transcode(std::istream& yaml, std::ostream& json, std::string& error);
+	};
+
+
+	/// <summary>
+	/// Binding of yaml documents to C++ structs: the fields are described once with TINY_YAML_BIND, then bind() fills the struct
+	/// straight from the parser events. No node is built.
+	/// Supported field types: bool, integral and floating point types, std::string, std::vector<T>, std::optional<T> and bound structs.
+	/// Every field must be in the document except the std::optional ones and the vectors (left empty); keys without a field are skipped.
+	/// </summary>
+	namespace binding {
+
+		/// <summary>
+		/// What the binder knows about one C++ type. One table per type, built on first use.
+		/// </summary>
+		struct TypeOps {
+			enum class Kind : std::uint8_t {
+				Scalar,
+				Struct,
+				Sequence,
+				Optional
+			};
+
+			Kind kind;
+			const char* expected;																// What the document must hold, for the errors ("an integer", "a mapping", ...)
+			bool (*scalar)(void* object, std::string_view text, Arena& scratch);				// Scalar: converts the text into the object
+			bool (*field)(void* object, std::string_view key, void*& field, const TypeOps*& fieldOps, std::size_t& index);	// Struct: finds the field of a key
+			std::string_view (*fieldName)(std::size_t index);									// Struct: key of the field
+			std::uint64_t required;																// Struct: one bit per field that must be present
+			void* (*emplace)(void* object, const TypeOps*& ops);								// Sequence: appends an item, Optional: constructs the value
+		};
+
+		template<typename C, typename M>
+		struct Field {
+			using Member = M;
+			std::string_view name;
+			M C::* member;
+		};
+
+		template<typename C, typename M>
+		constexpr Field<C, M> field(std::string_view name, M C::* member) {
+			return { name, member };
+		}
+
+		template<typename T, typename = void> struct IsBound : std::false_type {};
+		template<typename T> struct IsBound<T, std::void_t<decltype(tinyYamlFields(static_cast<const T*>(nullptr)))>> : std::true_type {};
+
+		template<typename T> struct IsVector : std::false_type {};
+		template<typename T, typename A> struct IsVector<std::vector<T, A>> : std::true_type {};
+
+		template<typename T> struct IsOptional : std::false_type {};
+		template<typename T> struct IsOptional<std::optional<T>> : std::true_type {};
+
+		template<typename T> const TypeOps& opsOf();
+
+		template<typename T>
+		bool convert(void* object, std::string_view text, Arena& scratch) {
+			T& target = *static_cast<T*>(object);
+			if constexpr (std::is_same_v<T, std::string>) {
+				target = std::string(Value::unquote(text, scratch));
+				return true;
+			}
+			else {
+				try {
+					Value value(text);
+					if constexpr (std::is_same_v<T, bool>)
+						target = value.as<bool>();
+					else if constexpr (std::is_integral_v<T>)
+						target = value.as<T>();
+					else
+						target = static_cast<T>(value.as<double>());
+					return true;
+				}
+				catch (const std::runtime_error&) {
+					return false;
+				}
+			}
+		}
+
+		template<typename T, std::size_t... I>
+		bool findField(void* object, std::string_view key, void*& field, const TypeOps*& fieldOps, std::size_t& index, std::index_sequence<I...>) {
+			constexpr auto fields = tinyYamlFields(static_cast<const T*>(nullptr));
+			T& target = *static_cast<T*>(object);
+			return ((key == std::get<I>(fields).name
+				&& (field = &(target.*std::get<I>(fields).member), fieldOps = &opsOf<typename std::tuple_element_t<I, std::decay_t<decltype(fields)>>::Member>(), index = I, true)) || ...);
+		}
+
+		template<typename T, std::size_t... I>
+		std::string_view fieldName(std::size_t index, std::index_sequence<I...>) {
+			constexpr auto fields = tinyYamlFields(static_cast<const T*>(nullptr));
+			std::string_view name;
+			((index == I && (name = std::get<I>(fields).name, true)) || ...);
+			return name;
+		}
+
+		template<typename T, std::size_t... I>
+		constexpr std::uint64_t requiredFields(std::index_sequence<I...>) {
+			using Fields = decltype(tinyYamlFields(static_cast<const T*>(nullptr)));
+			return (((IsOptional<typename std::tuple_element_t<I, Fields>::Member>::value || IsVector<typename std::tuple_element_t<I, Fields>::Member>::value) ? 0 : (std::uint64_t(1) << I)) | ... | 0);
+		}
+
+		template<typename T>
+		const TypeOps& opsOf() {
+			if constexpr (IsBound<T>::value) {
+				constexpr std::size_t count = std::tuple_size_v<decltype(tinyYamlFields(static_cast<const T*>(nullptr)))>;
+				static_assert(count <= 64, "TINY_YAML_BIND supports up to 64 fields per struct");
+				using Indices = std::make_index_sequence<count>;
+				static const TypeOps ops = { TypeOps::Kind::Struct, "a mapping", nullptr,
+					[](void* object, std::string_view key, void*& field, const TypeOps*& fieldOps, std::size_t& index) { return findField<T>(object, key, field, fieldOps, index, Indices()); },
+					[](std::size_t index) { return fieldName<T>(index, Indices()); },
+					requiredFields<T>(Indices()), nullptr };
+				return ops;
+			}
+			else if constexpr (IsVector<T>::value) {
+				static const TypeOps ops = { TypeOps::Kind::Sequence, "a sequence", nullptr, nullptr, nullptr, 0,
+					[](void* object, const TypeOps*& itemOps) -> void* {
+						itemOps = &opsOf<typename T::value_type>();
+						return &static_cast<T*>(object)->emplace_back();
+					} };
+				return ops;
+			}
+			else if constexpr (IsOptional<T>::value) {
+				static const TypeOps ops = { TypeOps::Kind::Optional, opsOf<typename T::value_type>().expected, nullptr, nullptr, nullptr, 0,
+					[](void* object, const TypeOps*& valueOps) -> void* {
+						valueOps = &opsOf<typename T::value_type>();
+						return &static_cast<T*>(object)->emplace();
+					} };
+				return ops;
+			}
+			else {
+				static_assert(std::is_arithmetic_v<T> || std::is_same_v<T, std::string>, "Type can not be bound: use bool, numbers, std::string, std::vector, std::optional or a struct described by TINY_YAML_BIND");
+				static const TypeOps ops = { TypeOps::Kind::Scalar,
+					std::is_same_v<T, bool> ? "a boolean" : std::is_integral_v<T> ? "an integer" : std::is_floating_point_v<T> ? "a number" : "a string",
+					&convert<T>, nullptr, nullptr, 0, nullptr };
+				return ops;
+			}
+		}
+
+		bool bindStream(std::istream& stream, void* object, const TypeOps& ops, std::string& error);
+		bool bindText(std::string_view text, void* object, const TypeOps& ops, std::string& error);
+	}
+
+
+	/// <summary>
+	/// Fills the struct from a yaml stream. On failure the struct may be partly filled.
+	/// </summary>
+	/// <param name="error">Where and why the document does not match the struct (e.g. "servers.1.port: expected an integer, got \"abc\" at line 7")</param>
+	/// <returns>False if the yaml is invalid, a field is missing or a value has the wrong type</returns>
+	template<typename T>
+	bool bind(std::istream& stream, T& object, std::string& error) {
+		return binding::bindStream(stream, &object, binding::opsOf<T>(), error);
+	}
+
+	/// <summary>
+	/// Fills the struct from a yaml document in memory, see bind(std::istream&, ...).
+	/// </summary>
+	template<typename T>
+	bool bind(std::string_view text, T& object, std::string& error) {
+		return binding::bindText(text, &object, binding::opsOf<T>(), error);
+	}
+
+	/// <summary>
+	/// Fills the struct from a yaml file, see bind(std::istream&, ...).
+	/// </summary>
+	template<typename T>
+	bool bindFile(const std::string& filepath, T& object, std::string& error) {
+		std::ifstream file(filepath, std::ios_base::in | std::ios_base::binary);
+		if (!file.is_open()) {
+			error = filepath + " cannot be opened";
+			return false;
+		}
+		return TINY_YAML::bind(file, object, error);		// Qualified, std::bind is found too
+	}
+
+
+	/// <summary>
+	/// One difference found by LiveYaml::reload().
+	/// </summary>
+	struct Change {
+		enum class Type : std::uint8_t {
+			Added,
+			Removed,
+			Modified
+		};
+
+		std::string path;																// Dot separated keys/indices, as taken by Yaml::compile()
+		Type type;
+	};
+
+
+	/// <summary>
+	/// A file reloaded on demand (e.g. on SIGHUP). Readers take the current snapshot and never block; reload() parses the file,
+	/// reuses the subtrees of the current snapshot that did not change (their nodes keep their address) and publishes the new snapshot atomically.
+	/// A snapshot stays valid as long as a reader holds it. Snapshots are read-only: they must not be loaded again.
+	/// The file is always parsed with one thread and without LoadOptions::lazy.
+	/// </summary>
+	class LiveYaml {
+	private:
+		std::string m_filepath;
+		LoadOptions m_options;
+		std::shared_ptr<Yaml> m_current;												// Only accessed with std::atomic_load/std::atomic_store
+		std::mutex m_reloadMutex;														// Serializes the reloads
+		std::string m_error;															// Why the last reload failed (empty if it succeeded)
+
+	public:
+		/// <summary>
+		/// Loads the first snapshot. Throws ParseException if the file can not be loaded.
+		/// </summary>
+		LiveYaml(const std::string& filepath, const LoadOptions& options = LoadOptions());
+
+		/// <summary>
+		/// </summary>
+		/// <returns>Current snapshot (lock-free)</returns>
+		std::shared_ptr<Yaml> snapshot() const {
+			return std::atomic_load(&this->m_current);
+		}
+
+		/// <summary>
+		/// Parses the file again. Nothing is published if nothing changed.
+		/// </summary>
+		/// <param name="changes">Receives the paths that were added, removed or modified (the deepest mapping/sequence levels that differ)</param>
+		/// <returns>False if the file can not be loaded, the current snapshot is kept</returns>
+		bool reload(std::vector<Change>& changes);
+
+		/// <summary>
+		/// </summary>
+		/// <returns>Why the last reload failed, empty if it succeeded</returns>
+		const std::string& getError() const {
+			return this->m_error;
+		}
+	};
+
+
+	/// <summary>
+	/// Pre-compiled path into a Yaml object. The first get() walks the segments and caches the node;
+	/// following calls return the cached pointer until the Yaml object is loaded again, then the path is walked once more.
+	/// </summary>
+	class Path {
+	private:
+		Yaml* m_yaml;																	// Document the path points into
+		std::vector<std::string> m_segments;											// Keys from the root to the node
+		std::atomic<Node*> m_node{ nullptr };											// Cached node (nullptr if it does not exist)
+		std::atomic<std::uint64_t> m_generation;										// Generation of the document the cache belongs to, published after m_node
+
+		Node* resolve();
+
+	public:
+		Path(Yaml& yaml, std::vector<std::string> segments);
+		Path(const Path& other);														// The copy resolves the path again on its first use
+		Path& operator=(const Path& other);
+
+		/// <summary>
+		/// Like the const lookups, a path can be shared by the readers of a document: the threads that refresh the cache
+		/// at the same time all store the node of the same generation.
+		/// </summary>
+		/// <returns>The node, nullptr if the path does not exist in the document</returns>
+		Node* get() {
+			if (this->m_generation.load(std::memory_order_acquire) == this->m_yaml->m_generation)
+				return this->m_node.load(std::memory_order_relaxed);
+			return resolve();
+		}
+
+		/// <summary>
+		/// Throws std::out_of_range if the path does not exist in the document.
+		/// </summary>
+		Node& operator*();
+
+		Node* operator->() {
+			return &**this;
 		}
 
-		Node& operator[](const std::string& identifier) {
-			return *m_roots[identifier];
+		const std::vector<std::string>& getSegments() const {
+			return this->m_segments;
 		}
 	};
 
@@ -203,5 +1562,11 @@ namespace TINY_YAML {
 }
 
 
+/// Describes the fields of a struct for TINY_YAML::bind. Use it at namespace scope, in the namespace of the struct:
+///		TINY_YAML_BIND(Server, TINY_YAML_FIELD(host), TINY_YAML_FIELD(port), TINY_YAML_FIELD_NAMED("max-connections", maxConnections))
+#define TINY_YAML_BIND(Type, ...) \
+	inline constexpr auto tinyYamlFields(const Type*) { using TinyYamlBound = Type; return std::make_tuple(__VA_ARGS__); }
+#define TINY_YAML_FIELD(member) TINY_YAML::binding::field(#member, &TinyYamlBound::member)
+#define TINY_YAML_FIELD_NAMED(key, member) TINY_YAML::binding::field(key, &TinyYamlBound::member)
 
 #endif